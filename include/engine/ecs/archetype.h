@@ -4,11 +4,17 @@
 //
 //  An archetype (table) stores all entities sharing the same set of component types. Each
 //  component is a contiguous column (SoA); row r holds one entity's components across all
-//  columns. Structural removal is swap-with-last (O(1)); rows relocate via memcpy.
+//  columns. Structural removal is swap-with-last (O(1)); rows relocate via memcpy. `mask` is the
+//  signature as a bitset, so "does this table hold all of a query's components" is one AND.
+//
+//  Change detection: every column keeps a per-row "last changed" tick (World::changeTick() at the
+//  time of the last mutable access) plus `changedTick`, an upper bound over its rows, so a
+//  changed<T>() query can skip whole untouched tables before looking at rows.
 //
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <vector>
@@ -22,29 +28,43 @@ struct Column {
     ComponentId            id   = 0;
     uint32_t               size = 0;   // bytes per element
     std::vector<std::byte> data;
+    std::vector<uint32_t>  ticks;             // row -> tick of last mutable access
+    uint32_t               changedTick = 0;   // >= every entry of `ticks`
+
+    void markChanged(uint32_t row, uint32_t tick) {
+        ticks[row] = tick;
+        changedTick = std::max(changedTick, tick);
+    }
 };
 
 struct Archetype {
     std::vector<ComponentId> signature;   // sorted component ids
+    ComponentMask            mask;         // same set as `signature`
     std::vector<Column>      columns;      // parallel to `signature`
     std::vector<Entity>      entities;     // row -> entity
     uint32_t                 count = 0;
 
     int columnIndex(ComponentId cid) const {
-        for (size_t i = 0; i < signature.size(); ++i)
-            if (signature[i] == cid) return static_cast<int>(i);
-        return -1;
+        if (!has(cid)) return -1;
+        const auto it = std::lower_bound(signature.begin(), signature.end(), cid);
+        return static_cast<int>(it - signature.begin());
     }
-    bool has(ComponentId cid) const { return columnIndex(cid) >= 0; }
+    bool has(ComponentId cid) const { return cid < kMaxComponents && mask.test(cid); }
+    bool hasAll(const ComponentMask& m) const { return (mask & m) == m; }
 
     void* columnPtr(int col, uint32_t row) {
         Column& c = columns[static_cast<size_t>(col)];
         return c.data.data() + static_cast<size_t>(row) * c.size;
     }
 
-    // Grows every column by one (uninitialized) element; returns the new row index.
-    uint32_t addRowUninitialized(Entity e) {
-        for (Column& c : columns) c.data.resize(c.data.size() + c.size);
+    // Grows every column by one (uninitialized) element, stamped as changed at `tick`; returns
+    // the new row index.
+    uint32_t addRowUninitialized(Entity e, uint32_t tick) {
+        for (Column& c : columns) {
+            c.data.resize(c.data.size() + c.size);
+            c.ticks.push_back(tick);
+            c.changedTick = std::max(c.changedTick, tick);
+        }
         entities.push_back(e);
         return count++;
     }
@@ -58,11 +78,15 @@ struct Archetype {
             for (Column& c : columns) {
                 std::memcpy(c.data.data() + static_cast<size_t>(row) * c.size,
                             c.data.data() + static_cast<size_t>(last) * c.size, c.size);
+                c.ticks[row] = c.ticks[last];
             }
             entities[row] = entities[last];
             moved = entities[row];
         }
-        for (Column& c : columns) c.data.resize(c.data.size() - c.size);
+        for (Column& c : columns) {
+            c.data.resize(c.data.size() - c.size);
+            c.ticks.pop_back();
+        }
         entities.pop_back();
         --count;
         return moved;
@@ -3,19 +3,28 @@
 //  engine::ecs
 //
 //  Compile-time component identity. Each component type T gets a stable ComponentId (a
-//  process-global static counter) plus its size/alignment. Components must be trivially
-//  copyable (rows are relocated between archetypes with memcpy).
+//  process-global atomic counter, so worlds may be built on several threads at once) plus its
+//  size/alignment. Components must be trivially
+//  copyable (rows are relocated between archetypes with memcpy). Ids are bounded by
+//  kMaxComponents so an archetype's component set fits a fixed bitset (ComponentMask); the first
+//  use of one type too many throws std::length_error.
 //
 
 #pragma once
 
+#include <atomic>
+#include <bitset>
 #include <cstdint>
+#include <stdexcept>
 #include <type_traits>
 
 namespace engine::ecs {
 
 using ComponentId = uint32_t;
 
+inline constexpr uint32_t kMaxComponents = 256;
+using ComponentMask = std::bitset<kMaxComponents>;   // bit i set ⇔ component id i present
+
 struct ComponentInfo {
     ComponentId id;
     uint32_t    size;
@@ -24,8 +33,11 @@ struct ComponentInfo {
 
 namespace detail {
 inline ComponentId nextComponentId() {
-    static ComponentId counter = 0;
-    return counter++;
+    static std::atomic<ComponentId> counter{ 0 };
+    const ComponentId id = counter.fetch_add(1, std::memory_order_relaxed);
+    if (id >= kMaxComponents)
+        throw std::length_error("engine::ecs: more than kMaxComponents component types registered");
+    return id;
 }
 }
 
@@ -44,4 +56,11 @@ const ComponentInfo& componentInfo() {
 template <class T>
 ComponentId componentId() { return componentInfo<T>().id; }
 
+template <class... Ts>
+ComponentMask componentMask() {
+    ComponentMask m;
+    (m.set(componentId<std::remove_cvref_t<Ts>>()), ...);
+    return m;
+}
+
 } // namespace engine::ecs
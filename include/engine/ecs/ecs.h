@@ -14,3 +14,4 @@
 #include "engine/ecs/world.h"
 #include "engine/ecs/query.h"
 #include "engine/ecs/scheduler.h"
+#include "engine/ecs/hierarchy.h"
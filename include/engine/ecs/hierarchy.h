@@ -0,0 +1,79 @@
+//
+//  hierarchy.h
+//  engine::ecs
+//
+//  Transform hierarchy. An entity with Transform + WorldTransform is a hierarchy node; adding
+//  Parent makes its Transform local to the parent. TransformHierarchy (a World resource) keeps
+//  the nodes in flat arrays sorted by depth across the whole forest (all roots, then every depth-1
+//  node, ...) — so a parent always precedes its children and each level is one contiguous range —
+//  and recomputes world matrices level by level. Only dirty branches are touched: a node is
+//  recomputed when its Transform changed (ECS change ticks) or its parent was recomputed. Nodes
+//  of one level are independent, so a wide level is split across the pool when one is given,
+//  whether it spans many trees or one. The layout is rebuilt when entities are spawned/destroyed
+//  or a Parent changes.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "engine/core/math/transform.h"
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/archetype.h"
+#include "engine/ecs/entity.h"
+#include "engine/ecs/scheduler.h"
+#include "engine/ecs/world.h"
+
+namespace engine::ecs {
+
+struct Parent {
+    Entity entity;   // dead/absent parent ⇒ the node is treated as a root
+};
+
+struct WorldTransform {
+    glm::mat4 matrix{1.0f};   // parent.world * local.matrix(); written by TransformHierarchy
+};
+
+class TransformHierarchy {
+public:
+    core::ThreadPool* pool = nullptr;   // optional; wide levels in parallel
+
+    // Brings every WorldTransform up to date (stamping the ones it writes as changed). Changes are
+    // picked up by tick, so the world's tick must advance between updates — the Schedule does;
+    // a hand-written loop calls world.advanceTick() once per frame.
+    void update(World& world);
+
+    size_t   nodeCount() const { return entity_.size(); }
+    uint32_t maxDepth() const { return maxDepth_; }
+    size_t   lastUpdated() const { return lastUpdated_; }   // nodes recomputed by the last update
+
+private:
+    // Node arrays, parallel; sorted by depth (breadth-first over the whole forest).
+    std::vector<Entity>            entity_;
+    std::vector<int32_t>           parent_;   // node index, -1 = root
+    std::vector<const Transform*>  local_;
+    std::vector<WorldTransform*>   out_;
+    std::vector<uint32_t*>         outTick_;
+    std::vector<glm::mat4>         world_;
+    std::vector<uint8_t>           dirty_;
+    std::vector<uint32_t>          levelBegin_;     // depth d = [begin[d], begin[d+1])
+    std::vector<uint32_t>          nodeOf_;         // entity index -> node (~0u = none)
+    std::vector<Column*>           outColumns_;     // WorldTransform columns (changedTick upkeep)
+
+    uint64_t structureVersion_ = ~0ull;
+    uint32_t since_ = 0;
+    uint32_t maxDepth_ = 0;
+    size_t   lastUpdated_ = 0;
+
+    void   rebuild(World& world);
+    size_t propagate(uint32_t begin, uint32_t end, uint32_t tick);
+};
+
+// System form: updates the world's TransformHierarchy resource (a no-op if none was set).
+void transformPropagateSystem(World& world);
+SystemAccess transformPropagateSystemAccess();
+
+} // namespace engine::ecs
@@ -6,13 +6,28 @@
 //  references (.each) or per-archetype contiguous spans (.chunks). `const T` in the query
 //  marks read-only access. Iteration order is stable (archetype creation order, then row).
 //
+//  Matching is cached: a QueryState<Ts...> holds the query's ComponentMask plus the list of
+//  matched archetypes with their resolved column indices. Archetypes are append-only, so a
+//  refresh only tests tables created since the last one (one bitset AND each). World::query
+//  uses the world's cached state per query type; a system may also own a QueryState directly.
+//
+//  Change detection: iterating a non-const T stamps T's row tick (see World::changeTick). An
+//  .each callback that returns bool stamps only when it returns true ("I actually wrote"), so a
+//  sync pass that usually finds nothing new leaves the ticks alone. `.changed<Us...>(since)`
+//  restricts iteration to rows where any of Us was stamped after `since`; .chunks filters at
+//  chunk granularity (a chunk with any such row is passed whole).
+//
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <mutex>
 #include <span>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "engine/ecs/archetype.h"
 #include "engine/ecs/component.h"
@@ -21,60 +36,192 @@
 
 namespace engine::ecs {
 
+// Rows pass if any listed component's tick is newer than `since`.
+struct ChangeFilter {
+    static constexpr uint32_t kMaxIds = 4;
+    ComponentId ids[kMaxIds] = {};
+    uint32_t    count = 0;
+    uint32_t    since = 0;
+};
+
 template <class... Ts>
-class Query {
+class QueryState : public detail::QueryStateBase {
 public:
-    explicit Query(World& world) : world_(&world) {}
+    static constexpr size_t kArity = sizeof...(Ts);
 
-    // fn(Entity, Ts&...)
+    struct Match {
+        uint32_t archetype = 0;
+        int      cols[kArity] = {};
+    };
+
+    QueryState() : mask_(componentMask<Ts...>()) {}
+
+    // Matches archetypes created since the last refresh. O(1) when none are new. A state is tied
+    // to the first world it refreshes against.
+    void refresh(World& world) {
+        std::vector<Archetype>& archs = world.archetypes();
+        const ComponentId ids[] = { componentId<std::remove_cvref_t<Ts>>()... };
+        for (; seen_ < archs.size(); ++seen_) {
+            const Archetype& a = archs[seen_];
+            if (!a.hasAll(mask_)) continue;
+            Match m;
+            m.archetype = static_cast<uint32_t>(seen_);
+            for (size_t i = 0; i < kArity; ++i) m.cols[i] = a.columnIndex(ids[i]);
+            matches_.push_back(m);
+        }
+    }
+
+    std::span<const Match> matches() const { return matches_; }
+    const ComponentMask&   mask() const { return mask_; }
+
+    // fn(Entity, Ts&...) over the cached matches (call refresh first if archetypes may be new).
+    // `filter` (optional) skips rows whose filtered components are unchanged.
     template <class F>
-    void each(F&& fn) {
-        for (Archetype& a : world_->archetypes()) {
+    void each(World& world, F&& fn, const ChangeFilter* filter = nullptr) const {
+        std::vector<Archetype>& archs = world.archetypes();
+        for (const Match& m : matches_) {
+            Archetype& a = archs[m.archetype];
             if (a.count == 0) continue;
-            int cols[sizeof...(Ts)];
-            if (!resolve(a, cols)) continue;
-            for (uint32_t r = 0; r < a.count; ++r)
-                dispatchEach(fn, a, r, cols, std::index_sequence_for<Ts...>{});
+            FilterCols fc;
+            if (filter && !resolveFilter(a, *filter, fc)) continue;
+            eachRow(fn, a, m.cols, world.changeTick(), filter ? &fc : nullptr,
+                    std::index_sequence_for<Ts...>{});
         }
     }
 
-    // fn(std::span<Ts>...) — one call per matching archetype
+    // fn(std::span<Ts>...) — one call per matching, non-empty archetype (with `filter`: only
+    // archetypes holding a changed row). Mutable spans stamp every row.
     template <class F>
-    void chunks(F&& fn) {
-        for (Archetype& a : world_->archetypes()) {
+    void chunks(World& world, F&& fn, const ChangeFilter* filter = nullptr) const {
+        std::vector<Archetype>& archs = world.archetypes();
+        for (const Match& m : matches_) {
+            Archetype& a = archs[m.archetype];
             if (a.count == 0) continue;
-            int cols[sizeof...(Ts)];
-            if (!resolve(a, cols)) continue;
-            dispatchChunk(fn, a, cols, std::index_sequence_for<Ts...>{});
+            FilterCols fc;
+            if (filter && !resolveFilter(a, *filter, fc)) continue;
+            chunk(fn, a, m.cols, std::index_sequence_for<Ts...>{});
+            const uint32_t tick = world.changeTick();
+            for (size_t i = 0; i < kArity; ++i) {
+                if (!kMutable[i]) continue;
+                Column& c = a.columns[static_cast<size_t>(m.cols[i])];
+                std::fill(c.ticks.begin(), c.ticks.end(), tick);
+                c.changedTick = std::max(c.changedTick, tick);
+            }
         }
     }
 
 private:
-    World* world_;
+    static constexpr bool kMutable[kArity] = { !std::is_const_v<Ts>... };
 
-    static bool resolve(Archetype& a, int (&cols)[sizeof...(Ts)]) {
-        const ComponentId ids[] = { componentId<std::remove_cvref_t<Ts>>()... };
-        for (size_t i = 0; i < sizeof...(Ts); ++i) {
-            cols[i] = a.columnIndex(ids[i]);
-            if (cols[i] < 0) return false;
+    struct FilterCols {
+        const uint32_t* ticks[ChangeFilter::kMaxIds] = {};
+        uint32_t        count = 0;
+        uint32_t        since = 0;
+    };
+
+    ComponentMask      mask_;
+    size_t             seen_ = 0;   // archetypes [0, seen_) already tested
+    std::vector<Match> matches_;
+
+    // False if no filtered column of `a` can hold a row changed after `since`.
+    static bool resolveFilter(Archetype& a, const ChangeFilter& f, FilterCols& out) {
+        uint32_t newest = 0;
+        out.since = f.since;
+        for (uint32_t k = 0; k < f.count; ++k) {
+            const int col = a.columnIndex(f.ids[k]);
+            if (col < 0) continue;
+            const Column& c = a.columns[static_cast<size_t>(col)];
+            out.ticks[out.count++] = c.ticks.data();
+            newest = std::max(newest, c.changedTick);
         }
-        return true;
+        return newest > f.since;
     }
 
     template <class F, size_t... I>
-    void dispatchEach(F& fn, Archetype& a, uint32_t r, int (&cols)[sizeof...(Ts)],
-                      std::index_sequence<I...>) {
-        fn(a.entities[r], *reinterpret_cast<Ts*>(a.columnPtr(cols[I], r))...);
+    static void eachRow(F& fn, Archetype& a, const int (&cols)[kArity], uint32_t tick,
+                        const FilterCols* filter, std::index_sequence<I...>) {
+        const std::tuple<Ts*...> base{ reinterpret_cast<Ts*>(a.columnPtr(cols[I], 0))... };
+        uint32_t* stamps[kArity] = {};
+        bool anyMutable = false;
+        for (size_t i = 0; i < kArity; ++i)
+            if (kMutable[i]) { stamps[i] = a.columns[static_cast<size_t>(cols[i])].ticks.data(); anyMutable = true; }
+
+        bool stamped = false;
+        for (uint32_t r = 0; r < a.count; ++r) {
+            if (filter) {
+                bool changed = false;
+                for (uint32_t k = 0; k < filter->count; ++k) changed |= filter->ticks[k][r] > filter->since;
+                if (!changed) continue;
+            }
+            bool wrote = true;
+            if constexpr (std::is_same_v<std::invoke_result_t<F&, Entity, Ts&...>, bool>)
+                wrote = fn(a.entities[r], std::get<I>(base)[r]...);
+            else
+                fn(a.entities[r], std::get<I>(base)[r]...);
+            if (anyMutable && wrote) {
+                for (size_t i = 0; i < kArity; ++i) if (stamps[i]) stamps[i][r] = tick;
+                stamped = true;
+            }
+        }
+        if (stamped)
+            for (size_t i = 0; i < kArity; ++i)
+                if (stamps[i]) {
+                    Column& c = a.columns[static_cast<size_t>(cols[i])];
+                    c.changedTick = std::max(c.changedTick, tick);
+                }
     }
 
     template <class F, size_t... I>
-    void dispatchChunk(F& fn, Archetype& a, int (&cols)[sizeof...(Ts)],
-                       std::index_sequence<I...>) {
+    static void chunk(F& fn, Archetype& a, const int (&cols)[kArity], std::index_sequence<I...>) {
         fn(std::span<Ts>(reinterpret_cast<Ts*>(a.columnPtr(cols[I], 0)), a.count)...);
     }
 };
 
+template <class... Ts>
+class Query {
+public:
+    explicit Query(World& world) : world_(&world) {}
+
+    // fn(Entity, Ts&...) — may return bool: false = "didn't write", row tick left as is.
+    template <class F>
+    void each(F&& fn) {
+        world_->cachedQueryState<Ts...>().each(*world_, fn, filter_.count ? &filter_ : nullptr);
+    }
+
+    // fn(std::span<Ts>...) — one call per matching archetype
+    template <class F>
+    void chunks(F&& fn) {
+        world_->cachedQueryState<Ts...>().chunks(*world_, fn, filter_.count ? &filter_ : nullptr);
+    }
+
+    // Only rows where any of Us changed after tick `since` (Us need not be among Ts).
+    template <class... Us>
+    Query changed(uint32_t since) const {
+        static_assert(sizeof...(Us) >= 1 && sizeof...(Us) <= ChangeFilter::kMaxIds);
+        Query q = *this;
+        q.filter_.count = 0;
+        ((q.filter_.ids[q.filter_.count++] = componentId<std::remove_cvref_t<Us>>()), ...);
+        q.filter_.since = since;
+        return q;
+    }
+
+private:
+    World*       world_;
+    ChangeFilter filter_;
+};
+
 template <class... Ts>
 Query<Ts...> World::query() { return Query<Ts...>(*this); }
 
+template <class... Ts>
+QueryState<Ts...>& World::cachedQueryState() {
+    const uint32_t id = queryStateId<Ts...>();
+    std::lock_guard<std::mutex> lk(*queryStatesMutex_);
+    if (id >= queryStates_.size()) queryStates_.resize(id + 1);
+    if (!queryStates_[id]) queryStates_[id] = std::make_unique<QueryState<Ts...>>();
+    auto& state = static_cast<QueryState<Ts...>&>(*queryStates_[id]);
+    state.refresh(*this);
+    return state;
+}
+
 } // namespace engine::ecs
@@ -6,42 +6,150 @@
 //  schedule invokes them in insertion order — deterministic by construction. Systems read
 //  shared state via World resources (e.g. Time{dt}) and iterate via queries.
 //
-//  Parallelism (across worlds, and later a read/write-declared within-world scheduler) is a
-//  planned extension; this ordered form is the phase-1 scheduler.
+//  Within-world parallelism: a system may declare the components + resources it reads/writes
+//  (SystemAccess, `const T` = read — the same convention as Query). At add() time each system is
+//  placed in the earliest batch after every earlier system it conflicts with, so run(world, pool)
+//  executes batches in order and the systems inside one batch concurrently. Conflicting systems
+//  keep their insertion order, and same-batch systems touch disjoint writes → results are
+//  identical to the serial run. Undeclared systems are exclusive (a batch of their own).
+//
+//  Change ticks: the world's tick advances before every system (serial) / batch (parallel), so a
+//  system that stores world.changeTick() when it runs sees, next time, every later write via
+//  query<...>().changed<T>(stored).
 //
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/component.h"
+#include "engine/ecs/world.h"
+
 namespace engine::ecs {
 
-class World;
+// Declared data access of one system. Declared systems may run concurrently with non-conflicting
+// ones, so they must not make structural changes (spawn/destroy/setResource) — leave such
+// systems undeclared (exclusive). A system that uses the pool itself should also stay exclusive:
+// exclusive systems run on the calling thread, never inside a pool task.
+struct SystemAccess {
+    std::vector<ComponentId> componentReads, componentWrites;
+    std::vector<uint32_t>    resourceReads, resourceWrites;
+    bool                     exclusive = false;
+
+    // Runs alone, on the calling thread (what an undeclared system gets).
+    static SystemAccess exclusiveAccess() {
+        SystemAccess a;
+        a.exclusive = true;
+        return a;
+    }
+
+    // components<Transform, const Velocity>() — `const T` reads T, plain T writes it.
+    template <class... Ts>
+    SystemAccess& components() {
+        (addAccess(componentReads, componentWrites, componentId<std::remove_cvref_t<Ts>>(),
+                   std::is_const_v<std::remove_reference_t<Ts>>), ...);
+        return *this;
+    }
+
+    // resources<const Time, PhysicsWorldRef>() — same convention, over World resources.
+    template <class... Ts>
+    SystemAccess& resources() {
+        (addAccess(resourceReads, resourceWrites, resourceId<std::remove_cvref_t<Ts>>(),
+                   std::is_const_v<std::remove_reference_t<Ts>>), ...);
+        return *this;
+    }
+
+    // Two systems conflict if either writes something the other reads or writes.
+    bool conflicts(const SystemAccess& o) const {
+        if (exclusive || o.exclusive) return true;
+        return intersects(componentWrites, o.componentReads) || intersects(componentWrites, o.componentWrites)
+            || intersects(o.componentWrites, componentReads)
+            || intersects(resourceWrites, o.resourceReads) || intersects(resourceWrites, o.resourceWrites)
+            || intersects(o.resourceWrites, resourceReads);
+    }
+
+private:
+    // Keeps both lists sorted + unique; a write subsumes a read of the same id.
+    static void addAccess(std::vector<uint32_t>& reads, std::vector<uint32_t>& writes,
+                          uint32_t id, bool readOnly) {
+        auto insert = [](std::vector<uint32_t>& v, uint32_t x) {
+            auto it = std::lower_bound(v.begin(), v.end(), x);
+            if (it == v.end() || *it != x) v.insert(it, x);
+        };
+        if (readOnly) {
+            if (!std::binary_search(writes.begin(), writes.end(), id)) insert(reads, id);
+        } else {
+            insert(writes, id);
+            if (auto it = std::lower_bound(reads.begin(), reads.end(), id); it != reads.end() && *it == id)
+                reads.erase(it);
+        }
+    }
+
+    static bool intersects(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] == b[j]) return true;
+            if (a[i] < b[j]) ++i; else ++j;
+        }
+        return false;
+    }
+};
 
 struct SystemDesc {
     std::string                    name;
     std::function<void(World&)>    fn;
+    SystemAccess                   access = SystemAccess::exclusiveAccess();
+    uint32_t                       batch = 0;   // index into Schedule::batches()
 };
 
 class Schedule {
 public:
+    // Undeclared system: exclusive (runs alone, on the calling thread).
     Schedule& add(std::string name, std::function<void(World&)> fn) {
-        systems_.push_back({ std::move(name), std::move(fn) });
+        return add(std::move(name), SystemAccess::exclusiveAccess(), std::move(fn));
+    }
+
+    // Declared system: batched after every earlier system it conflicts with.
+    Schedule& add(std::string name, SystemAccess access, std::function<void(World&)> fn) {
+        uint32_t batch = 0;
+        for (const SystemDesc& s : systems_)
+            if (s.access.conflicts(access)) batch = std::max(batch, s.batch + 1);
+        if (batch == batches_.size()) batches_.emplace_back();
+        batches_[batch].push_back(static_cast<uint32_t>(systems_.size()));
+        systems_.push_back({ std::move(name), std::move(fn), std::move(access), batch });
         return *this;
     }
 
+    // Serial: every system in insertion order.
     void run(World& world) const {
-        for (const auto& s : systems_) s.fn(world);
+        for (const auto& s : systems_) { world.advanceTick(); s.fn(world); }
+    }
+
+    // Parallel: batches in order; the systems of a batch concurrently across the pool. A batch
+    // of one system runs inline (so an exclusive system may use the pool itself).
+    void run(World& world, core::ThreadPool& pool) const {
+        for (const std::vector<uint32_t>& batch : batches_) {
+            world.advanceTick();
+            if (batch.size() == 1) { systems_[batch[0]].fn(world); continue; }
+            pool.parallelFor(batch.size(), [&](size_t i) { systems_[batch[i]].fn(world); });
+        }
     }
 
     size_t size() const { return systems_.size(); }
     const std::vector<SystemDesc>& systems() const { return systems_; }
+    // System indices per batch (execution order of run(world, pool)); for inspection/tests.
+    const std::vector<std::vector<uint32_t>>& batches() const { return batches_; }
 
 private:
-    std::vector<SystemDesc> systems_;
+    std::vector<SystemDesc>            systems_;
+    std::vector<std::vector<uint32_t>> batches_;
 };
 
 } // namespace engine::ecs
@@ -4,18 +4,28 @@
 //
 //  The World owns entities and archetypes. spawn<Ts...> creates an entity in the archetype
 //  matching its component set; get/has access components; destroy swap-removes. query<Ts...>
-//  (see query.h) iterates matching archetypes. Single-threaded; parallelism is across worlds.
+//  (see query.h) iterates matching archetypes through a per-world cache of QueryStates (one per
+//  query type, refreshed incrementally as archetypes are created). Structural changes are
+//  single-threaded; concurrent systems (Schedule batches) may only read/write component data.
+//
+//  Resources are typed singletons in a dense table indexed by resourceId<T>() — a lookup is a
+//  bounds check + load, with each value owned by a unique_ptr (stable address until replaced).
+//
+//  Change ticks: spawn and every mutable access (get<T>, a query over non-const T) stamp the row
+//  with changeTick(). advanceTick() starts a new tick (the Schedule does so before each system /
+//  batch); a consumer remembers the tick it last processed and asks for rows changed since.
 //
 
 #pragma once
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <type_traits>
-#include <unordered_map>
 #include <vector>
 
 #include "engine/ecs/archetype.h"
@@ -25,12 +35,35 @@
 namespace engine::ecs {
 
 namespace detail {
-inline uint32_t nextResourceId() { static uint32_t counter = 0; return counter++; }
+inline uint32_t nextResourceId() {
+    static std::atomic<uint32_t> counter{ 0 };
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
 }
 template <class T>
 uint32_t resourceId() { static const uint32_t id = detail::nextResourceId(); return id; }
 
-template <class... Ts> class Query;   // query.h
+template <class... Ts> class Query;        // query.h
+template <class... Ts> class QueryState;   // query.h
+
+namespace detail {
+inline uint32_t nextQueryStateId() {
+    static std::atomic<uint32_t> counter{ 0 };
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+struct QueryStateBase { virtual ~QueryStateBase() = default; };
+
+// Type-erased owner for one resource value (deleter = the `delete` of its concrete type).
+// `podSize` is sizeof(T) for trivially copyable T — those are included in World snapshots.
+struct ResourceDeleter {
+    void (*destroy)(void*) = nullptr;
+    uint32_t podSize = 0;
+    void operator()(void* p) const { destroy(p); }
+};
+using ResourcePtr = std::unique_ptr<void, ResourceDeleter>;
+}
+template <class... Ts>
+uint32_t queryStateId() { static const uint32_t id = detail::nextQueryStateId(); return id; }
 
 class World {
 public:
@@ -44,13 +77,15 @@ public:
         const uint32_t archIdx = findOrCreateArchetype(infos.data(), infos.size());
         const Entity e = newEntity();
         Archetype& a = archetypes_[archIdx];
-        const uint32_t row = a.addRowUninitialized(e);
+        const uint32_t row = a.addRowUninitialized(e, changeTick_);
         (writeComponent<Ts>(a, row, comps), ...);
         records_[e.index].archetype = archIdx;
         records_[e.index].row = row;
+        ++structureVersion_;
         return e;
     }
 
+    // get<T> marks the component changed; get<const T> is a read.
     template <class T>
     T* get(Entity e) {
         if (!alive(e)) return nullptr;
@@ -58,6 +93,8 @@ public:
         Archetype& a = archetypes_[rec.archetype];
         const int col = a.columnIndex(componentId<std::remove_cvref_t<T>>());
         if (col < 0) return nullptr;
+        if constexpr (!std::is_const_v<T>)
+            a.columns[static_cast<size_t>(col)].markChanged(rec.row, changeTick_);
         return reinterpret_cast<T*>(a.columnPtr(col, rec.row));
     }
 
@@ -75,19 +112,49 @@ public:
     void destroy(Entity e);
     size_t size() const { return liveCount_; }
 
+    // --- snapshots (snapshot.cpp) ---
+    // Serializes entity records, every archetype's rows (columns copied as raw byte ranges) and
+    // the trivially copyable resources into a flat buffer. With `base` (a full snapshot of this
+    // world), writes a delta: only column chunks whose bytes differ from `base` (archetypes whose
+    // row count changed are written whole). Physics/other external state is not included.
+    void snapshot(std::vector<std::byte>& out, const std::vector<std::byte>* base = nullptr) const;
+    // Restores a snapshot taken from this world (or one that created the same archetypes in the
+    // same order). A delta needs the full snapshot it was taken against as `base`. Archetypes
+    // created after the snapshot are emptied; resources set after it are kept. All restored rows
+    // count as changed (stamped with changeTick()). A truncated buffer, or one whose archetypes
+    // do not line up with this world's, throws std::runtime_error and leaves the world as it was.
+    void restore(const std::vector<std::byte>& in, const std::vector<std::byte>* base = nullptr);
+
+    // --- change detection ---
+    uint32_t changeTick() const { return changeTick_; }
+    // Ends the current tick and returns it: rows stamped from now on compare greater. A consumer
+    // outside a Schedule does `since = world.advanceTick();` after processing its changes.
+    uint32_t advanceTick() { return changeTick_++; }
+    // Bumped by every spawn/destroy — row/entity layout caches are stale when it differs.
+    uint64_t structureVersion() const { return structureVersion_; }
+
     // --- resources (typed singletons: Time, camera, config, ...) ---
     template <class T>
     void setResource(T value) {
-        resources_[resourceId<T>()] = std::make_shared<T>(std::move(value));
+        const uint32_t id = resourceId<T>();
+        if (id >= resources_.size()) resources_.resize(id + 1);
+        resources_[id] = detail::ResourcePtr(
+            new T(std::move(value)),
+            { [](void* p) { delete static_cast<T*>(p); },
+              std::is_trivially_copyable_v<T> ? static_cast<uint32_t>(sizeof(T)) : 0u });
     }
     template <class T>
     T* getResource() {
-        auto it = resources_.find(resourceId<T>());
-        return it == resources_.end() ? nullptr : static_cast<T*>(it->second.get());
+        const uint32_t id = resourceId<T>();
+        return id < resources_.size() ? static_cast<T*>(resources_[id].get()) : nullptr;
     }
 
     template <class... Ts> Query<Ts...> query();   // defined in query.h
 
+    // The world's cached matching state for Query<Ts...>, already refreshed against the current
+    // archetypes. Lookup + refresh are serialized, so concurrent systems may query. (query.h)
+    template <class... Ts> QueryState<Ts...>& cachedQueryState();
+
     // Access for Query.
     std::vector<Archetype>& archetypes() { return archetypes_; }
 
@@ -103,8 +170,14 @@ private:
     std::vector<uint32_t>  freeIndices_;
     std::vector<Archetype> archetypes_;
     std::map<std::vector<ComponentId>, uint32_t> archetypeIndex_;   // ordered → deterministic
-    std::unordered_map<uint32_t, std::shared_ptr<void>> resources_;
+    std::vector<detail::ResourcePtr> resources_;   // indexed by resourceId<T>(); null = unset
     size_t                 liveCount_ = 0;
+    uint32_t               changeTick_ = 1;   // 0 = "before anything"; wraps after 2^32 ticks
+    uint64_t               structureVersion_ = 0;
+
+    // Indexed by queryStateId<Ts...>(); created on first use of a query type in this world.
+    std::vector<std::unique_ptr<detail::QueryStateBase>> queryStates_;
+    std::unique_ptr<std::mutex> queryStatesMutex_ = std::make_unique<std::mutex>();
 
     uint32_t findOrCreateArchetype(const ComponentInfo* infos, size_t n);   // world.cpp
     Entity   newEntity();                                                    // world.cpp
@@ -0,0 +1,92 @@
+//
+//  dynamic_tree.h
+//  engine::physics / broadphase
+//
+//  Incremental dynamic AABB tree (Box2D-style BVH) with a persistent pair set. Each proxy is
+//  stored with a FAT box (its tight box grown by `fatMargin`); a proxy is reinserted only when
+//  its tight box leaves the fat one, and only reinserted proxies are re-queried, so static level
+//  geometry and resting bodies cost nothing per step. Unlike the grid, cost does not depend on
+//  the largest box in the scene — the mixed-size / big-static-geometry case.
+//
+//  Pairs are kept between fat boxes (id space, sorted) and updated from the moved proxies only;
+//  update() then emits the subset whose TIGHT boxes overlap, as indices into the input — the same
+//  contract and order as uniformGrid/sweepAndPrune, so the narrowphase sees identical input.
+//  Deterministic: the tree is built in input order and all pair lists are sorted.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "engine/physics/broadphase/aabb.h"
+
+namespace engine::physics::broadphase {
+
+class DynamicTree {
+public:
+    explicit DynamicTree(Real fatMargin = Real(0.1)) : margin_(fatMargin) {}
+
+    // Syncs the proxies to `aabbs` and refreshes the pair set. `ids[k]` is a stable key for
+    // aabbs[k] (e.g. a body slot), strictly ascending; ids absent since the last update are
+    // removed. Writes tight-overlap pairs as (k, l) indices into `aabbs`, sorted by (k, l).
+    void update(std::span<const uint32_t> ids, std::span<const Aabb> aabbs, std::vector<Pair>& pairs);
+
+    // Fat-box pairs (id, id) that appeared / disappeared in the last update; sorted.
+    std::span<const Pair> added() const { return added_; }
+    std::span<const Pair> removed() const { return removed_; }
+    size_t pairCount() const { return pairs_.size(); }     // persistent fat-box pairs
+    size_t proxyCount() const { return live_.size(); }
+    size_t lastMoved() const { return moved_.size(); }    // proxies reinserted by the last update
+    int32_t height() const { return root_ < 0 ? 0 : nodes_[root_].height; }
+
+    // Calls f(id) for every proxy whose fat box overlaps `box`.
+    template <class F>
+    void query(const Aabb& box, F&& f) const {
+        if (root_ < 0) return;
+        stack_.clear();
+        stack_.push_back(root_);
+        while (!stack_.empty()) {
+            const Node& n = nodes_[stack_.back()];
+            stack_.pop_back();
+            if (!overlaps(n.box, box)) continue;
+            if (n.leaf()) f(n.id);
+            else { stack_.push_back(n.left); stack_.push_back(n.right); }
+        }
+    }
+
+private:
+    struct Node {
+        Aabb     box;
+        int32_t  parent = -1;
+        int32_t  left = -1, right = -1;   // children; left == -1 ⇒ leaf
+        int32_t  height = 0;              // leaf = 0; -1 on the free list
+        uint32_t id = 0;                  // leaf: caller key
+        bool leaf() const { return left < 0; }
+    };
+
+    Real                 margin_;
+    std::vector<Node>    nodes_;
+    int32_t              root_ = -1;
+    int32_t              free_ = -1;       // free list threaded through Node::parent
+    mutable std::vector<int32_t> stack_;
+
+    std::vector<int32_t>  proxyOf_;        // id -> leaf node, -1 = none
+    std::vector<uint32_t> indexOf_;        // id -> index in the current update's input
+    std::vector<uint32_t> movedStamp_;     // id -> stamp_ when reinserted this update
+    uint32_t              stamp_ = 0;
+    std::vector<uint32_t> live_;           // ids with a proxy (ascending)
+    std::vector<uint32_t> moved_;          // ids reinserted this update (ascending)
+    std::vector<Pair>     pairs_, kept_, candidates_, added_, removed_;
+
+    int32_t allocate();
+    void    release(int32_t n);
+    void    insertLeaf(int32_t leaf);
+    void    removeLeaf(int32_t leaf);
+    int32_t balance(int32_t a);
+    void    refit(int32_t n);
+    bool    moved(uint32_t id) const { return movedStamp_[id] == stamp_; }
+};
+
+} // namespace engine::physics::broadphase
@@ -0,0 +1,29 @@
+//
+//  hierarchical_grid.h
+//  engine::physics / broadphase
+//
+//  Multi-level spatial-hash grid for mixed object sizes. Level L has cell size base·2^L, with
+//  base = twice the smallest AABB extent; each box lives in the finest level whose cell fits it
+//  (so it spans at most 2 cells per axis there). Pairs within a level come from shared cells,
+//  exactly as in uniformGrid; pairs across levels come from each box probing the cells it covers
+//  on every COARSER occupied level. A few large bodies therefore no longer inflate the cell size
+//  for everything else (uniformGrid's cell = largest AABB). Same flat sorted-entry design and the
+//  same output contract: pairs sorted + de-duplicated by (i, j).
+//
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "engine/physics/broadphase/aabb.h"
+
+namespace engine::core { class ThreadPool; }
+
+namespace engine::physics::broadphase {
+
+// `pool` (optional) parallelizes the internal entry sort for large inputs.
+void hierarchicalGrid(std::span<const Aabb> aabbs, std::vector<Pair>& pairs,
+                      core::ThreadPool* pool = nullptr);
+
+} // namespace engine::physics::broadphase
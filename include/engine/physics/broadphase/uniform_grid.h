@@ -19,7 +19,9 @@ namespace engine::core { class ThreadPool; }
 
 namespace engine::physics::broadphase {
 
-// `pool` (optional) parallelizes the internal entry sort for large inputs.
+// `pool` (optional, >= 4096 boxes) runs every stage in parallel — cell size, entry generation
+// (count, scan, fill), entry sort, per-cell pairing and the de-duplication — with a fixed chunking
+// and an ordered merge, so the pairs are exactly the serial result.
 void uniformGrid(std::span<const Aabb> aabbs, std::vector<Pair>& pairs,
                  core::ThreadPool* pool = nullptr);
 
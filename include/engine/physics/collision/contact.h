@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "engine/physics/types.h"
 
 namespace engine::physics {
@@ -21,6 +23,11 @@ struct Contact {
     Vec3 point{0};          // world-space contact point
     Real separation = 0;    // signed distance between surfaces; < 0 when overlapping
     bool touching = false;  // separation <= margin
+    // Stable id of the feature pair that generated this point (e.g. incident vertex / clip edge /
+    // reference face), unique within its manifold and unchanged while the same features touch.
+    // 0 = none (single-point tests); consumers fall back to the point's index. Bit 15 is always
+    // set on a real id, so the two never collide.
+    uint32_t feature = 0;
 };
 
 } // namespace engine::physics
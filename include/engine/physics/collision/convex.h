@@ -14,6 +14,8 @@
 
 namespace engine::physics::collide {
 
-bool convexVsConvex(const SupportShape& a, const SupportShape& b, Contact& out);
+// `separatingAxis` (optional) receives GJK's separating axis on a miss, zero otherwise.
+bool convexVsConvex(const SupportShape& a, const SupportShape& b, Contact& out,
+                    Vec3* separatingAxis = nullptr);
 
 } // namespace engine::physics::collide
@@ -8,12 +8,17 @@
 //  stacking for hulls, mirroring what box_box does for boxes). Falls back to the single EPA
 //  point when a genuine face pair isn't found (edge/vertex contact).
 //
+//  Cooked polytopes (a CookedHull, or the unit box scaled to a box's half-extents) skip the
+//  vertex scans: the reference and incident faces come straight from the face list, already
+//  ordered, and only their own vertices are transformed.
+//
 
 #pragma once
 
 #include <span>
 
 #include "engine/physics/collision/contact.h"
+#include "engine/physics/shapes/cooked_hull.h"
 #include "engine/physics/types.h"
 
 namespace engine::physics::collide {
@@ -21,4 +26,14 @@ namespace engine::physics::collide {
 int polytopeManifold(std::span<const Vec3> vertsA, std::span<const Vec3> vertsB,
                      const Contact& epa, Contact out[4]);
 
+// A cooked polytope in the world: local vertex v sits at center + orient * (scale * v).
+struct PolytopeView {
+    const CookedHull* hull = nullptr;
+    Vec3 scale{1};
+    Vec3 center{0};
+    Quat orient{1, 0, 0, 0};
+};
+
+int polytopeManifold(const PolytopeView& a, const PolytopeView& b, const Contact& epa, Contact out[4]);
+
 } // namespace engine::physics::collide
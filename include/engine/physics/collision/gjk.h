@@ -3,7 +3,9 @@
 //  engine::physics / collision
 //
 //  Gilbert–Johnson–Keerthi boolean intersection test for two convex shapes. On overlap it
-//  returns the enclosing simplex (a tetrahedron) that EPA expands to recover penetration.
+//  returns the enclosing simplex (a tetrahedron) that EPA expands to recover penetration; on a
+//  miss it can report the separating axis it found, which a caller may keep per pair and test
+//  first next time (gjkSeparated) — resting neighbours usually stay separated along it.
 //
 
 #pragma once
@@ -31,6 +33,14 @@ struct Simplex {
     }
 };
 
-bool gjkIntersect(const SupportShape& a, const SupportShape& b, Simplex& out);
+// `separatingAxis` (optional) receives the direction d with max (A−B)·d < 0 on a miss, and
+// zero on overlap.
+bool gjkIntersect(const SupportShape& a, const SupportShape& b, Simplex& out,
+                  Vec3* separatingAxis = nullptr);
+
+// True when `axis` (non-zero) separates a and b: one Minkowski support query.
+inline bool gjkSeparated(const SupportShape& a, const SupportShape& b, const Vec3& axis) {
+    return glm::dot(axis, axis) >= kEpsilon && glm::dot(minkowskiSupport(a, b, axis), axis) < 0;
+}
 
 } // namespace engine::physics
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "engine/physics/collision/contact.h"
+#include "engine/physics/shapes/cooked_hull.h"
 #include "engine/physics/shapes/shapes.h"
 #include "engine/physics/types.h"
 
@@ -38,4 +39,9 @@ int boxVsPlane(const Vec3& boxCenter, const Quat& boxOrient, const Box& box,
 // hulls). Contact normal = plane normal. Returns the number of contacts.
 int pointsVsPlane(const Vec3* worldPoints, int count, const Plane& plane, Real margin, Contact out[4]);
 
+// Cooked hull vs half-space plane: the same contacts as pointsVsPlane over all of its vertices,
+// but only the vertices within the margin are visited (flood fill from the deepest one).
+int hullVsPlane(const Vec3& center, const Quat& orient, const CookedHull& hull,
+                const Plane& plane, Real margin, Contact out[4]);
+
 } // namespace engine::physics::collide
@@ -12,6 +12,7 @@
 
 #include <glm/gtc/quaternion.hpp>
 
+#include "engine/physics/shapes/cooked_hull.h"
 #include "engine/physics/types.h"
 
 namespace engine::physics {
@@ -27,6 +28,8 @@ struct SupportShape {
     Vec3 halfExtents{Real(0.5)};      // box
     const Vec3* verts = nullptr;      // hull (local-space vertices)
     int         vertCount = 0;
+    const CookedHull* cooked = nullptr;   // hull topology (verts = cooked->vertices): hill-climb
+    mutable int       hint = 0;           // last support vertex — the next climb starts there
 
     static SupportShape sphere(const Vec3& c, Real r) {
         SupportShape s; s.kind = Kind::Sphere; s.center = c; s.radius = r; return s;
@@ -37,6 +40,11 @@ struct SupportShape {
     static SupportShape hull(const Vec3& c, const Quat& q, const Vec3* v, int n) {
         SupportShape s; s.kind = Kind::Hull; s.center = c; s.orient = q; s.verts = v; s.vertCount = n; return s;
     }
+    static SupportShape hull(const Vec3& c, const Quat& q, const CookedHull& h) {
+        SupportShape s = hull(c, q, h.vertices.data(), static_cast<int>(h.vertices.size()));
+        s.cooked = &h;
+        return s;
+    }
     static SupportShape capsule(const Vec3& c, const Quat& q, Real r, Real hh) {
         SupportShape s; s.kind = Kind::Capsule; s.center = c; s.orient = q; s.radius = r; s.halfHeight = hh; return s;
     }
@@ -61,6 +69,10 @@ struct SupportShape {
         }
         // hull: farthest local vertex along the (local) direction
         const Vec3 d = glm::conjugate(orient) * dir;
+        if (cooked) {
+            hint = cooked->support(d, hint);
+            return center + orient * verts[hint];
+        }
         int best = 0;
         Real bd = glm::dot(verts[0], d);
         for (int i = 1; i < vertCount; ++i) {
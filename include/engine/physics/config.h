@@ -32,7 +32,20 @@ struct SolverConfig {
     Real contactSlop      = Real(0.005);    // allowed resting penetration before correction (m)
     Real maxCorrection    = Real(2);        // cap on Baumgarte correction velocity (m/s)
     Real aabbMargin       = Real(0.01);     // broadphase AABB fattening (m)
+    Real treeFatMargin    = Real(0.1);      // DynamicTree broadphase: proxy box slack before reinsertion (m)
     Real jointBaumgarte   = Real(0.2);      // joint position-drift correction fraction (no slop)
+    // Sleeping (WorldDef::allowSleep): a body rests while |v| and |ω| stay under these speeds; an
+    // island whose bodies have all rested for sleepTime seconds is put to sleep.
+    Real sleepLinearVelocity  = Real(0.05); // m/s
+    Real sleepAngularVelocity = Real(0.05); // rad/s
+    Real sleepTime            = Real(0.5);  // s
+    // Adaptive iteration counts (SequentialImpulse path): > 0 ⇒ each island sweeps until no
+    // constraint's accumulated impulse changed by more than the tolerance (N·s) in a sweep, capped
+    // at maxVelocityIterations / maxPositionIterations; 0 ⇒ the fixed WorldDef counts (default).
+    Real velocityTolerance     = Real(0);
+    Real positionTolerance     = Real(0);
+    int  maxVelocityIterations = 32;
+    int  maxPositionIterations = 16;
 
     // --- Realtime TGS-Soft contact solver (WorldDef::contactSolver == TGSSoft) ---
     // Soft-constraint contact params (Box2D-v3-style): the normal constraint behaves like a stiff
@@ -23,7 +23,8 @@ namespace engine::physics {
 
 // Bump when the SimConfig schema changes (fields added/removed/renamed) so serialized logs are
 // interpretable across engine versions.
-inline constexpr int kConfigVersion = 1;
+// 2: solver.sleep*; 3: solver.treeFatMargin; 4: solver tolerances / iteration caps.
+inline constexpr int kConfigVersion = 4;
 
 inline const char* backendName(Backend b) { return b == Backend::Reduced ? "Reduced" : "Realtime"; }
 inline const char* actionModeName(ActionMode m) { return m == ActionMode::PDTarget ? "PDTarget" : "Torque"; }
@@ -56,7 +57,15 @@ inline std::string serialize(const SimConfig& c) {
     kv(s, "solver.contactSlop", c.solver.contactSlop);
     kv(s, "solver.maxCorrection", c.solver.maxCorrection);
     kv(s, "solver.aabbMargin", c.solver.aabbMargin);
+    kv(s, "solver.treeFatMargin", c.solver.treeFatMargin);
     kv(s, "solver.jointBaumgarte", c.solver.jointBaumgarte);
+    kv(s, "solver.sleepLinearVelocity", c.solver.sleepLinearVelocity);
+    kv(s, "solver.sleepAngularVelocity", c.solver.sleepAngularVelocity);
+    kv(s, "solver.sleepTime", c.solver.sleepTime);
+    kv(s, "solver.velocityTolerance", c.solver.velocityTolerance);
+    kv(s, "solver.positionTolerance", c.solver.positionTolerance);
+    kv(s, "solver.maxVelocityIterations", c.solver.maxVelocityIterations);
+    kv(s, "solver.maxPositionIterations", c.solver.maxPositionIterations);
     kv(s, "solver.pgsIterations", c.solver.pgsIterations);
     kv(s, "solver.maxContactsPerManifold", c.solver.maxContactsPerManifold);
     kv(s, "solver.reducedBaumgarte", c.solver.reducedBaumgarte);
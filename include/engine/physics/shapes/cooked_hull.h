@@ -0,0 +1,78 @@
+//
+//  cooked_hull.h
+//  engine::physics / shapes
+//
+//  A ConvexHull's point cloud cooked once (at createBody) into a polytope: the extreme vertices,
+//  polygonal faces (coplanar triangles merged, so a box has 6 quads), a half-edge mesh linking
+//  them, and exact solid mass properties. Queries then walk the topology instead of scanning
+//  every vertex: support() hill-climbs the vertex graph (a linear function's local maximum on a
+//  convex polytope is the global one), plane contacts flood-fill from the deepest vertex, and
+//  clipping reads reference/incident faces straight from the face loops.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "engine/physics/types.h"
+
+namespace engine::physics {
+
+struct CookedHull {
+    struct HalfEdge {
+        uint16_t origin = 0;   // vertex the edge leaves
+        uint16_t twin = 0;     // opposite half-edge (on the neighbouring face)
+        uint16_t next = 0;     // next edge around the face (counter-clockwise about its normal)
+        uint16_t face = 0;
+    };
+    struct Face {
+        Vec3     normal{0, 1, 0};   // outward, unit
+        Real     offset = 0;        // plane: dot(normal, x) = offset
+        uint16_t edge = 0;          // first half-edge of the face loop
+        uint16_t count = 0;         // loop length
+    };
+
+    // Hull vertices in input order (interior and mid-edge/mid-face points dropped).
+    std::vector<Vec3>     vertices;
+    std::vector<uint16_t> vertexEdge;   // one outgoing half-edge per vertex
+    std::vector<HalfEdge> edges;
+    std::vector<Face>     faces;
+
+    // Solid mass properties at unit density.
+    Real volume = 0;
+    Vec3 centroid{0};
+    Mat3 inertia{Real(0)};              // per unit mass, about the centroid, local axes
+
+    bool empty() const { return faces.empty(); }
+
+    // Index of a vertex farthest along `dir`, climbing from `start` (any vertex; a nearby
+    // answer — e.g. the previous query's — makes the walk short).
+    int support(const Vec3& dir, int start = 0) const {
+        int v = start;
+        Real best = glm::dot(vertices[v], dir);
+        for (;;) {
+            int up = v;
+            uint32_t e = vertexEdge[v];
+            do {                                            // the one-ring around v
+                const int u = edges[edges[e].twin].origin;
+                const Real d = glm::dot(vertices[u], dir);
+                if (d > best) { best = d; up = u; }
+                e = edges[edges[e].twin].next;
+            } while (e != vertexEdge[v]);
+            if (up == v) return v;
+            v = up;
+        }
+    }
+};
+
+// Cooks the convex hull of `points`. Returns false (and leaves `out` empty) when the points span
+// no volume or the hull exceeds the 16-bit topology indices; callers then treat the collider as a
+// bare vertex cloud.
+bool cookHull(std::span<const Vec3> points, CookedHull& out);
+
+// The cube [-1, 1]³, cooked once: box colliders use it scaled by their half-extents.
+const CookedHull& unitBoxHull();
+
+} // namespace engine::physics
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <span>
 
@@ -51,7 +52,16 @@ struct BodyDef {
     uint32_t        collisionMask     = 0xFFFFFFFFu;
 };
 
-enum class BroadphaseKind { SweepAndPrune, UniformGrid };
+// Broadphase selection (realtime backend). UniformGrid rebuilds a hash grid each substep (cell =
+// largest AABB: best for many similar-sized bodies); SweepAndPrune sorts along one axis; DynamicTree
+// keeps an incremental fat-AABB BVH and a persistent pair set across steps, touching only bodies
+// that moved out of their fat box (mixed sizes, large static level geometry); HierarchicalGrid is
+// the grid with one level per size class (pebbles next to boulders). All find the same pairs.
+// UniformGrid, DynamicTree and HierarchicalGrid also emit them in the same order, so they simulate
+// bit-identically; SweepAndPrune emits them in sweep order, which changes the solver's constraint
+// order — its results match the others only within a small tolerance (1e-3 m over the
+// broadphase_equivalence scene), not bit for bit.
+enum class BroadphaseKind { SweepAndPrune, UniformGrid, DynamicTree, HierarchicalGrid };
 
 // Realtime contact solver selection. SequentialImpulse = the original PGS velocity solver (+ the
 // split-impulse / warm-start flags below). TGSSoft = substepped Temporal Gauss-Seidel with soft
@@ -61,20 +71,23 @@ enum class ContactSolver { SequentialImpulse, TGSSoft };
 
 struct WorldDef {
     Vec3               gravity{0, Real(-9.81), 0};
+    // Velocity sweeps per substep — a fixed count, or with SolverConfig::velocityTolerance set,
+    // replaced by a per-island residual early-out capped at SolverConfig::maxVelocityIterations.
     int                velocityIterations = 8;
     int                substeps = 1;
     // Split-impulse position-correction sweeps per substep (realtime backend). Penetration is
     // resolved on a SEPARATE pseudo-velocity that moves positions but is discarded afterwards, so it
     // never feeds the real velocity (no Baumgarte energy injection). A few sweeps depenetrate well;
-    // 0 disables the position pass (falls back to no penetration correction). Contacts only — joints
-    // keep their own Baumgarte bias.
+    // 0 disables the position pass (falls back to no penetration correction). Joint drift is
+    // corrected in the same pass; without it joints fall back to a real-velocity Baumgarte bias.
     int                positionIterations = 4;
     // Contact warm-starting: seed each contact's normal impulse from the previous substep/step's
-    // solved value (persistent per-contact cache) and apply it before iterating. Improves convergence
-    // for tall clean stacks, BUT as implemented the key is (bodyA,bodyB,contactIdx) — a positional
-    // index that misapplies impulses when a manifold's point order shifts (moving/articulated bodies),
-    // which regresses ragdoll settling (see 2026-08-01 contact-stability investigation). Default OFF
-    // until the key uses stable feature IDs / point-matching. Opt-in via this flag.
+    // solved value (persistent per-contact cache) and apply it before iterating — the key to stack
+    // convergence at a fixed iteration count. Contacts are keyed by (bodyA, bodyB, feature id), so
+    // an impulse follows its vertex/edge/face pair when the manifold's point order shifts. Default
+    // OFF, and not planned on: even with joint drift on the pseudo-velocity the passive ragdoll
+    // settles worse warm (an arm lying straight keeps rocking about its long axis). Opt in for deep
+    // stacks. false = cold start every substep.
     bool               contactWarmStart = false;
     // Contact solver selection (realtime backend). Default SequentialImpulse (with the split-impulse
     // + warm-start flags); set TGSSoft to use the substepped soft-constraint solver.
@@ -83,6 +96,22 @@ struct WorldDef {
     // discarded pseudo-velocity (no Baumgarte energy injection); false = legacy Baumgarte push-out
     // folded into the real velocity solve (energy-injecting, but stiffer). Ignored by TGSSoft.
     bool               splitImpulse = true;
+    // Wide contact solve (SequentialImpulse path): each color's contacts are packed into SIMD
+    // blocks (8 lanes with AVX2 — CMake ENGINE_PHYSICS_AVX2 — else 4 with SSE2/NEON/portable)
+    // and solved lane-parallel. Same math and order as the one-at-a-time solve; false = scalar.
+    // Ignored by TGSSoft.
+    bool               wideContactSolver = true;
+    // Shape-batched narrowphase (realtime backend): candidate pairs are bucketed by shape kind
+    // and sphere-sphere, sphere-plane, capsule-plane and box-plane pairs are tested a SIMD block
+    // at a time (same widths as wideContactSolver) with the scalar tests' math and contact order;
+    // other kinds take the one-pair GJK/EPA/clipping path. false = every pair one at a time.
+    bool               batchedNarrowphase = true;
+    // Direct joint solve (SequentialImpulse path): joints forming a tree (an articulation, with at
+    // most one joint to a static/kinematic body) are solved exactly each velocity iteration by a
+    // linear-time sparse LDLᵀ of the tree's KKT system, factored once per substep, instead of by
+    // Gauss-Seidel sweeps — stiff chains hold with few iterations. Hinge limits, contacts and
+    // non-tree joints still iterate. Off by default. Ignored by TGSSoft.
+    bool               directJointSolver = false;
     BroadphaseKind     broadphase = BroadphaseKind::UniformGrid;
 
     // Optional velocity damping (models drag; per second). 0 = none (default). Applied to dynamic
@@ -91,12 +120,24 @@ struct WorldDef {
     Real               angularDamping = Real(0);
 
     // Optional: if set, the step parallelizes its embarrassingly-parallel stages (integration,
-    // narrowphase) across the pool when body/pair counts exceed `parallelThreshold`. Results
-    // are identical to serial (deterministic). The broadphase sort and the contact solver
-    // remain serial for now.
+    // narrowphase) across the pool when body/pair counts exceed `parallelThreshold`. The realtime
+    // SI solve runs independent islands (bodies linked by contacts/joints) as pool tasks, and a
+    // single island above the threshold by contact color. Results are identical to serial
+    // (deterministic).
     core::ThreadPool*  threadPool = nullptr;
     int                parallelThreshold = 4096;
 
+    // Island sleeping (realtime backend): an island that stays under the solver.sleep* speeds for
+    // solver.sleepTime is frozen — skipped by integration, narrowphase and the solve — until an
+    // awake body or moving kinematic touches it, a joint on it changes, or setBodyState /
+    // destroyBody hits a member or a body it rests on. Its cached contacts keep being reported.
+    // Off by default: sleeping bodies hold their exact pose, which resets/replays must opt into.
+    bool               allowSleep = false;
+
+    // Contact reporting (realtime backend): false = no ContactEvent is built and contacts() stays
+    // empty, for callers that never read it (batch training). The solve is unaffected.
+    bool               contactEvents = true;
+
     // Continuous collision detection: swept broadphase AABBs + speculative contacts so fast
     // bodies don't tunnel through finite colliders in one step.
     bool               continuousDetection = true;
@@ -112,6 +153,65 @@ struct ContactEvent {
     Real       separation = 0;
 };
 
+// Counters of the last step() (PhysicsWorld::stepStats()), kept in every build configuration — a
+// few increments and clock reads per substep. Work counts and stage times are summed over the
+// step's substeps; graph sizes and iteration counts are the largest any substep saw. Stages a
+// backend does not have stay 0 (the reduced backend has no broadphase, coloring or islands).
+// Residuals are the largest accumulated-impulse change (N·s) any constraint took in an island's
+// final sweep; with an adaptive tolerance (SolverConfig::velocityTolerance / positionTolerance)
+// that is what the early-out compares against.
+struct StepStats {
+    // collision
+    long candidatePairs = 0;       // pairs that reached the narrowphase (broadphase + plane pairs)
+    long contacts = 0;             // contact points generated
+    long gjkCalls = 0;             // GJK queries (convex fallback + capsule-vs-convex distance)
+    long epaCalls = 0;             // EPA expansions (GJK queries that found an overlap)
+    long gjkAxisHits = 0;          // GJK queries skipped: the pair's cached separating axis held
+    // solver graph
+    int  contactColors = 0;
+    int  jointColors = 0;
+    int  islands = 0;              // islands with at least one contact or joint
+    // solver work
+    int  velocityIterations = 0;   // most velocity sweeps any island used in one substep
+    int  positionIterations = 0;   // most split-impulse position sweeps, likewise
+    long velocitySweeps = 0;       // island velocity sweeps summed over islands + substeps (cost)
+    long positionSweeps = 0;
+    Real velocityResidual = 0;     // largest final-sweep residual over islands + substeps
+    Real positionResidual = 0;
+    // wall time per stage (ms)
+    double broadphaseMs = 0;       // AABBs + pair search
+    double narrowphaseMs = 0;      // contact generation
+    double graphMs = 0;            // coloring, islands, joint preparation
+    double solveMs = 0;            // velocity + position solve
+    double integrateMs = 0;        // forces, actuators, dynamics, position integration
+    double totalMs = 0;            // the whole step() call
+};
+
+// Folds another world's stats into `into` (e.g. across a batch of envs): counts, islands and times
+// add; colors, iteration counts and residuals take the maximum.
+inline void accumulate(StepStats& into, const StepStats& s) {
+    into.candidatePairs += s.candidatePairs;
+    into.contacts += s.contacts;
+    into.gjkCalls += s.gjkCalls;
+    into.epaCalls += s.epaCalls;
+    into.gjkAxisHits += s.gjkAxisHits;
+    into.contactColors = std::max(into.contactColors, s.contactColors);
+    into.jointColors = std::max(into.jointColors, s.jointColors);
+    into.islands += s.islands;
+    into.velocityIterations = std::max(into.velocityIterations, s.velocityIterations);
+    into.positionIterations = std::max(into.positionIterations, s.positionIterations);
+    into.velocitySweeps += s.velocitySweeps;
+    into.positionSweeps += s.positionSweeps;
+    into.velocityResidual = std::max(into.velocityResidual, s.velocityResidual);
+    into.positionResidual = std::max(into.positionResidual, s.positionResidual);
+    into.broadphaseMs += s.broadphaseMs;
+    into.narrowphaseMs += s.narrowphaseMs;
+    into.graphMs += s.graphMs;
+    into.solveMs += s.solveMs;
+    into.integrateMs += s.integrateMs;
+    into.totalMs += s.totalMs;
+}
+
 // --- Articulation (Milestone 2, Phase B): maximal-coordinate joint constraints ---------------
 // A joint is a persistent bilateral constraint between two bodies, solved in the same
 // sequential-impulse loop as contacts (see the articulation decision note). The API is kept
@@ -226,11 +326,19 @@ public:
     virtual std::span<const engine::Transform> poses() const              = 0;
     virtual std::span<const Vec3>               linearVelocities() const  = 0;
     virtual std::span<const Vec3>               angularVelocities() const = 0;
+    // Current generation of each body slot: a handle is live iff its generation matches (destroying
+    // a body bumps it, so a stale handle never matches a slot that has since been reused).
+    virtual std::span<const uint32_t>           bodyGenerations() const   = 0;
+    // The same for joint slots (indexed by JointHandle.index; destroyJoint bumps it).
+    virtual std::span<const uint32_t>           jointGenerations() const  = 0;
 
     // Single-body convenience.
     virtual engine::Transform pose(BodyHandle) const = 0;
 
     virtual std::span<const ContactEvent> contacts() const = 0;
+
+    // Counters of the last step() (zeros before the first step).
+    virtual const StepStats& stepStats() const = 0;
 };
 
 // `Backend` now lives in engine/physics/config.h (so SimConfig can reference it).
@@ -3,23 +3,40 @@
 //  engine::physics_ecs
 //
 //  Schedule-compatible systems (void(ecs::World&)) that bridge the ECS and the PhysicsWorld.
-//  Add them in order to an ecs::Schedule; both read a PhysicsWorldRef resource.
+//  Add them in order to an ecs::Schedule; both read a PhysicsWorldRef resource. Each has a
+//  matching *Access() declaration for a parallel Schedule (the PhysicsWorld behind the
+//  PhysicsWorldRef counts as that resource, so mutating it is a resource write).
 //
 
 #pragma once
 
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/scheduler.h"
 #include "engine/ecs/world.h"
+#include "engine/physics/world.h"
 
 namespace engine::physics_ecs {
 
 // Advances the physics world by one fixed step (reads PhysicsWorldRef + FixedStep resources).
 void stepSystem(ecs::World& world);
 
-// Copies world body poses into each entity's Transform (reads PhysicsWorldRef).
+// Copies world body poses into each entity's Transform (reads PhysicsWorldRef). See syncPoses.
 void syncSystem(ecs::World& world);
 
-// Writes each <Joint, JointCommand> entity's command into the PhysicsWorld actuator (Phase B4).
-// Run before stepSystem in a schedule (reads PhysicsWorldRef).
+// The bulk path behind syncSystem: one poses() call, then per <RigidBody, Transform> table a
+// straight scatter from the pose array into the Transform column (RigidBody.body.index is the
+// row → body map), optionally split across `pool` for big tables. Only moved rows are written
+// and change-stamped. Stale handles (destroyed body, slot possibly reused) are skipped by generation.
+void syncPoses(ecs::World& world, const physics::PhysicsWorld& pw, core::ThreadPool* pool = nullptr);
+
+// Writes each <Joint, JointCommand> entity's command into the PhysicsWorld actuator (Phase B4):
+// as bulk setJointTargets/setJointTorques when the entities cover every joint index once with
+// live handles, else per joint (stale handles are then rejected by the world). Run before stepSystem in a schedule (reads PhysicsWorldRef).
 void actuatorFlushSystem(ecs::World& world);
 
+// Declared access of the systems above, for Schedule::add(name, access, fn).
+ecs::SystemAccess stepSystemAccess();
+ecs::SystemAccess syncSystemAccess();
+ecs::SystemAccess actuatorFlushSystemAccess();
+
 } // namespace engine::physics_ecs
@@ -62,6 +62,7 @@ public:
     physics::Vec3        rootLinearVelocity() const;
     physics::Vec3        rootAngularVelocity() const;
     std::span<const uint8_t> bodyContactFlags() const { return contactFlags_; }  // per articulation body
+    const physics::StepStats& stepStats() const { return world_->stepStats(); }   // last step's counters
 
     // --- optional default flat observation (convenience for tests/examples, NOT the contract) ---
     //  layout: root pos(3) + root quat(4) + root linVel(3) + root angVel(3)
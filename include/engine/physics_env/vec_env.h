@@ -44,6 +44,11 @@ public:
     // Apply actions() → step all envs (parallel across the pool) → refresh observations().
     void step() override;
 
+    // Physics counters of the last step() over all envs (physics::accumulate): work and times
+    // summed across envs, iteration counts and residuals their maximum. Times are per-env wall
+    // time added up — CPU cost, not the batch's latency.
+    const physics::StepStats& stepStats() const { return stats_; }
+
     Environment&       env(size_t i)       { return *envs_[i]; }
     const Environment& env(size_t i) const { return *envs_[i]; }
 
@@ -57,6 +62,7 @@ private:
     size_t                                    obsDim_ = 0;
     std::vector<float>                        actions_;   // [N * actDim]
     std::vector<float>                        obs_;       // [N * obsDim]
+    physics::StepStats                        stats_;
 };
 
 } // namespace engine::physics_env
@@ -24,12 +24,25 @@ namespace engine::scene {
 struct ExtractedScene {
     std::vector<render::InstanceData> instances;
     std::vector<render::RenderItem>   items;   // one per (mesh) batch; contiguous instance runs
+
+    // Incremental-extract state (see extract): which instance slot each entity owns, and the
+    // world layout / change tick the lists were built against. `updated` counts the instances
+    // the last extract rewrote (all of them on a full rebuild).
+    std::vector<uint32_t> instanceOf;             // entity index -> instance slot
+    uint64_t              structureVersion = ~0ull;
+    uint32_t              since   = 0;
+    uint32_t              updated = 0;
 };
 
 // Queries <Transform, RenderMesh, RenderMaterial>, buckets instances by mesh, and fills `out`
 // with one RenderItem per mesh + a contiguous InstanceData run. Deterministic order (mesh id).
 // Pipeline-free: how the items are drawn (the mesh pipeline) is the consuming renderer's concern
 // (see Renderer::setMeshPipeline), not part of the extracted scene.
+// Incremental: when `out` was last filled from this world and no entity was spawned/destroyed and
+// no RenderMesh changed since, only instances whose Transform/RenderMaterial changed (ECS change
+// ticks) are rewritten in place — static scenery costs nothing. Consumes changes up to and
+// including world.changeTick() and leaves the tick alone: whoever owns the frame (a Schedule, or
+// the loop calling world.advanceTick()) must start a new tick before the next writes.
 void extract(ecs::World& world, ExtractedScene& out);
 
 // Builds one render::RenderView per camera entity (<Transform, engine::Camera>): the view
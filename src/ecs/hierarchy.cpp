@@ -0,0 +1,201 @@
+//
+//  hierarchy.cpp
+//  engine::ecs
+//
+
+#include "engine/ecs/hierarchy.h"
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+
+#include "engine/ecs/query.h"
+
+namespace engine::ecs {
+
+namespace {
+
+// Below this many nodes in a level the pool handoff costs more than the propagation; a parallel
+// level is cut into blocks of kLevelBlock nodes.
+constexpr size_t kParallelMinLevel = 1024;
+constexpr size_t kLevelBlock       = 256;
+
+// a * b for an affine b (bottom row 0,0,0,1 — any TRS matrix): per column, three 4-wide
+// multiply-adds on a's columns (glm vectorizes these), plus a's translation for column 3.
+inline glm::mat4 mulAffine(const glm::mat4& a, const glm::mat4& b) {
+    glm::mat4 r;
+    for (int c = 0; c < 3; ++c) r[c] = a[0] * b[c].x + a[1] * b[c].y + a[2] * b[c].z;
+    r[3] = a[0] * b[3].x + a[1] * b[3].y + a[2] * b[3].z + a[3];
+    return r;
+}
+
+} // namespace
+
+void TransformHierarchy::rebuild(World& world) {
+    struct Raw {
+        Entity           e;
+        Entity           parent;
+        const Transform* local;
+        WorldTransform*  out;
+        uint32_t*        tick;
+    };
+    std::vector<Raw> raw;
+    outColumns_.clear();
+
+    const ComponentMask mask = componentMask<Transform, WorldTransform>();
+    const ComponentId   tId = componentId<Transform>(), wId = componentId<WorldTransform>(),
+                        pId = componentId<Parent>();
+    for (Archetype& a : world.archetypes()) {
+        if (a.count == 0 || !a.hasAll(mask)) continue;
+        const int tc = a.columnIndex(tId), wc = a.columnIndex(wId), pc = a.columnIndex(pId);
+        Column& wcol = a.columns[static_cast<size_t>(wc)];
+        outColumns_.push_back(&wcol);
+        for (uint32_t r = 0; r < a.count; ++r) {
+            raw.push_back({ a.entities[r],
+                            pc >= 0 ? static_cast<const Parent*>(a.columnPtr(pc, r))->entity : Entity{},
+                            static_cast<const Transform*>(a.columnPtr(tc, r)),
+                            static_cast<WorldTransform*>(a.columnPtr(wc, r)),
+                            wcol.ticks.data() + r });
+        }
+    }
+
+    const uint32_t n = static_cast<uint32_t>(raw.size());
+    std::vector<uint32_t> rawOf;   // entity index -> raw node
+    for (uint32_t i = 0; i < n; ++i) {
+        if (raw[i].e.index >= rawOf.size()) rawOf.resize(raw[i].e.index + 1, ~0u);
+        rawOf[raw[i].e.index] = i;
+    }
+
+    // Children as CSR in raw order (deterministic).
+    std::vector<int32_t>  rawParent(n, -1);
+    std::vector<uint32_t> childStart(n + 1, 0), children(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        const Entity p = raw[i].parent;
+        if (!world.alive(p) || p.index >= rawOf.size() || rawOf[p.index] == ~0u || rawOf[p.index] == i) continue;
+        rawParent[i] = static_cast<int32_t>(rawOf[p.index]);
+        ++childStart[rawOf[p.index] + 1];
+    }
+    std::partial_sum(childStart.begin(), childStart.end(), childStart.begin());
+    {
+        std::vector<uint32_t> fill(childStart.begin(), childStart.end() - 1);
+        for (uint32_t i = 0; i < n; ++i)
+            if (rawParent[i] >= 0) children[fill[static_cast<size_t>(rawParent[i])]++] = i;
+    }
+
+    // Roots: parentless nodes, plus one cut per parent cycle (the first node the roots cannot
+    // reach; its cycle and everything below hang off it).
+    std::vector<uint8_t>  reached(n, 0);
+    std::vector<uint32_t> roots, stack;
+    auto reach = [&](uint32_t root) {
+        roots.push_back(root);
+        reached[root] = 1;
+        stack.assign(1, root);
+        while (!stack.empty()) {
+            const uint32_t r = stack.back();
+            stack.pop_back();
+            for (uint32_t c = childStart[r]; c < childStart[r + 1]; ++c)
+                if (!reached[children[c]]) { reached[children[c]] = 1; stack.push_back(children[c]); }
+        }
+    };
+    for (uint32_t i = 0; i < n; ++i)
+        if (rawParent[i] < 0) reach(i);
+    for (uint32_t i = 0; i < n; ++i)
+        if (!reached[i]) reach(i);
+
+    entity_.clear(); parent_.clear(); local_.clear(); out_.clear(); outTick_.clear();
+    levelBegin_.clear();
+    std::vector<uint32_t> nodeOfRaw(n, ~0u);
+    auto push = [&](uint32_t r, int32_t parentNode) {
+        nodeOfRaw[r] = static_cast<uint32_t>(entity_.size());
+        entity_.push_back(raw[r].e);
+        parent_.push_back(parentNode);
+        local_.push_back(raw[r].local);
+        out_.push_back(raw[r].out);
+        outTick_.push_back(raw[r].tick);
+    };
+
+    // Breadth-first over the whole forest, one level at a time; the node arrays are the queue.
+    for (uint32_t r : roots) push(r, -1);
+    for (uint32_t begin = 0; begin < entity_.size();) {
+        const uint32_t end = static_cast<uint32_t>(entity_.size());
+        levelBegin_.push_back(begin);
+        for (uint32_t q = begin; q < end; ++q) {
+            const uint32_t r = rawOf[entity_[q].index];
+            for (uint32_t c = childStart[r]; c < childStart[r + 1]; ++c)
+                if (nodeOfRaw[children[c]] == ~0u) push(children[c], static_cast<int32_t>(q));
+        }
+        begin = end;
+    }
+    levelBegin_.push_back(n);
+    maxDepth_ = n ? static_cast<uint32_t>(levelBegin_.size()) - 2 : 0;
+
+    nodeOf_.assign(rawOf.size(), ~0u);
+    for (uint32_t i = 0; i < n; ++i) nodeOf_[raw[i].e.index] = nodeOfRaw[i];
+    world_.resize(n);
+    dirty_.assign(n, 1);
+    structureVersion_ = world.structureVersion();
+}
+
+// Nodes [begin, end) of one level; their parents' world matrices are final.
+size_t TransformHierarchy::propagate(uint32_t begin, uint32_t end, uint32_t tick) {
+    size_t updated = 0;
+    for (uint32_t i = begin; i < end; ++i) {
+        const int32_t p = parent_[i];
+        if (p >= 0 && dirty_[static_cast<size_t>(p)]) dirty_[i] = 1;
+        if (!dirty_[i]) continue;
+        const glm::mat4 local = local_[i]->matrix();
+        world_[i] = p >= 0 ? mulAffine(world_[static_cast<size_t>(p)], local) : local;
+        out_[i]->matrix = world_[i];
+        *outTick_[i] = tick;
+        ++updated;
+    }
+    return updated;
+}
+
+void TransformHierarchy::update(World& world) {
+    bool relayout = structureVersion_ != world.structureVersion();
+    if (!relayout)
+        world.query<const Parent>().changed<Parent>(since_).chunks([&](std::span<const Parent>) { relayout = true; });
+    if (relayout) {
+        rebuild(world);
+    } else {
+        world.query<const Transform, const WorldTransform>().changed<Transform>(since_).each(
+            [&](Entity e, const Transform&, const WorldTransform&) { dirty_[nodeOf_[e.index]] = 1; });
+    }
+
+    const uint32_t tick = world.changeTick();
+    lastUpdated_ = 0;
+    std::vector<size_t> counts;
+    for (size_t d = 0; d + 1 < levelBegin_.size(); ++d) {
+        const uint32_t begin = levelBegin_[d], end = levelBegin_[d + 1];
+        if (!pool || end - begin < kParallelMinLevel) {
+            lastUpdated_ += propagate(begin, end, tick);
+            continue;
+        }
+        const size_t blocks = (end - begin + kLevelBlock - 1) / kLevelBlock;
+        counts.assign(blocks, 0);
+        pool->parallelFor(blocks, [&](size_t k) {
+            const uint32_t b = begin + static_cast<uint32_t>(k * kLevelBlock);
+            counts[k] = propagate(b, std::min(end, b + static_cast<uint32_t>(kLevelBlock)), tick);
+        });
+        for (size_t c : counts) lastUpdated_ += c;
+    }
+    std::fill(dirty_.begin(), dirty_.end(), uint8_t{ 0 });
+    if (lastUpdated_)
+        for (Column* c : outColumns_) c->changedTick = std::max(c->changedTick, tick);
+
+    since_ = tick;
+}
+
+void transformPropagateSystem(World& world) {
+    if (auto* h = world.getResource<TransformHierarchy>()) h->update(world);
+}
+
+// With TransformHierarchy::pool set the system parallelizes itself — register it undeclared
+// (exclusive) instead, so it never runs inside another pool task.
+SystemAccess transformPropagateSystemAccess() {
+    return SystemAccess{}.components<const Parent, const Transform, WorldTransform>()
+                         .resources<TransformHierarchy>();
+}
+
+} // namespace engine::ecs
@@ -0,0 +1,309 @@
+//
+//  snapshot.cpp
+//  engine::ecs
+//
+//  World::snapshot / World::restore. The buffer is a flat byte stream (native endianness, for
+//  in-process rollback/branching — not a file format):
+//
+//    header   magic, kind (full/delta), sizeof(Record), counts, liveCount
+//    records  Record[]            (raw)
+//    free     uint32_t[]          (raw)
+//    per archetype: signature, column element sizes, Entity[] (raw), then per column either the
+//                   whole byte range or (delta) a list of kChunkBytes-sized chunks that differ
+//                   from the base snapshot
+//    resources: (id, size, bytes) for every trivially copyable resource
+//
+//  A truncated buffer, or one that does not fit this world, throws std::runtime_error before the
+//  world is touched.
+//
+
+#include "engine/ecs/world.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace engine::ecs {
+
+namespace {
+
+constexpr uint32_t kMagic      = 0x31534345u;   // "ECS1"
+constexpr uint32_t kFull       = 0;
+constexpr uint32_t kDelta      = 1;
+constexpr size_t   kChunkBytes = 4096;          // delta granularity per column
+
+void require(bool ok, const char* what) {
+    if (!ok) throw std::runtime_error(std::string("ECS snapshot: ") + what);
+}
+
+template <class T>
+void put(std::vector<std::byte>& out, const T& v) {
+    const size_t at = out.size();
+    out.resize(at + sizeof(T));
+    std::memcpy(out.data() + at, &v, sizeof(T));
+}
+
+void putBytes(std::vector<std::byte>& out, const void* p, size_t n) {
+    if (n == 0) return;
+    const size_t at = out.size();
+    out.resize(at + n);
+    std::memcpy(out.data() + at, p, n);
+}
+
+struct Reader {
+    const std::byte* p;
+    const std::byte* end;
+
+    template <class T>
+    T get() {
+        T v;
+        std::memcpy(&v, take(sizeof(T)), sizeof(T));
+        return v;
+    }
+    const std::byte* take(size_t n) {
+        require(static_cast<size_t>(end - p) >= n, "truncated buffer");
+        const std::byte* r = p;
+        p += n;
+        return r;
+    }
+};
+
+struct ColumnView {
+    uint32_t                                          size = 0;
+    const std::byte*                                  data = nullptr;   // full mode
+    std::vector<std::pair<uint32_t, const std::byte*>> chunks;          // delta mode
+};
+
+struct ArchetypeView {
+    uint32_t                 count   = 0;
+    bool                     chunked = false;
+    std::vector<ComponentId> signature;
+    const std::byte*         entities = nullptr;
+    std::vector<ColumnView>  columns;
+};
+
+struct ResourceView {
+    uint32_t         id   = 0;
+    uint32_t         size = 0;
+    const std::byte* data = nullptr;
+};
+
+struct SnapshotView {
+    uint32_t                   kind = kFull;
+    uint64_t                   liveCount = 0;
+    uint32_t                   recordCount = 0, freeCount = 0;
+    const std::byte*           records = nullptr;
+    const std::byte*           freeIndices = nullptr;
+    std::vector<ArchetypeView> archetypes;
+    std::vector<ResourceView>  resources;
+};
+
+size_t chunkLength(size_t total, uint32_t chunk) {
+    return std::min(kChunkBytes, total - static_cast<size_t>(chunk) * kChunkBytes);
+}
+
+SnapshotView parse(const std::vector<std::byte>& buf, size_t recordSize) {
+    Reader r{ buf.data(), buf.data() + buf.size() };
+    SnapshotView s;
+    require(r.get<uint32_t>() == kMagic, "not an ECS snapshot");
+    s.kind = r.get<uint32_t>();
+    require(s.kind == kFull || s.kind == kDelta, "unknown snapshot kind");
+    require(r.get<uint32_t>() == recordSize, "entity record size differs from this build");
+    s.recordCount = r.get<uint32_t>();
+    s.freeCount = r.get<uint32_t>();
+    const uint32_t archetypeCount = r.get<uint32_t>();
+    s.liveCount = r.get<uint64_t>();
+    s.records = r.take(static_cast<size_t>(s.recordCount) * recordSize);
+    s.freeIndices = r.take(static_cast<size_t>(s.freeCount) * sizeof(uint32_t));
+
+    s.archetypes.resize(archetypeCount);
+    for (ArchetypeView& a : s.archetypes) {
+        const uint32_t n = r.get<uint32_t>();
+        a.count = r.get<uint32_t>();
+        a.chunked = r.get<uint32_t>() != 0;
+        a.signature.resize(n);
+        a.columns.resize(n);
+        for (ComponentId& id : a.signature) {
+            id = r.get<ComponentId>();
+            require(id < kMaxComponents, "component id out of range");
+        }
+        for (ColumnView& c : a.columns) c.size = r.get<uint32_t>();
+        a.entities = r.take(static_cast<size_t>(a.count) * sizeof(Entity));
+        for (ColumnView& c : a.columns) {
+            const size_t bytes = static_cast<size_t>(a.count) * c.size;
+            if (!a.chunked) { c.data = r.take(bytes); continue; }
+            c.chunks.resize(r.get<uint32_t>());
+            for (auto& [k, p] : c.chunks) {
+                k = r.get<uint32_t>();
+                require(static_cast<size_t>(k) * kChunkBytes < bytes, "delta chunk out of range");
+                p = r.take(chunkLength(bytes, k));
+            }
+        }
+    }
+
+    s.resources.resize(r.get<uint32_t>());
+    for (ResourceView& res : s.resources) {
+        res.id = r.get<uint32_t>();
+        res.size = r.get<uint32_t>();
+        res.data = r.take(res.size);
+    }
+    return s;
+}
+
+} // namespace
+
+void World::snapshot(std::vector<std::byte>& out, const std::vector<std::byte>* base) const {
+    SnapshotView b;
+    if (base) {
+        b = parse(*base, sizeof(Record));
+        require(b.kind == kFull, "delta snapshots are taken against a full snapshot");
+    }
+
+    out.clear();
+    put(out, kMagic);
+    put(out, base ? kDelta : kFull);
+    put(out, static_cast<uint32_t>(sizeof(Record)));
+    put(out, static_cast<uint32_t>(records_.size()));
+    put(out, static_cast<uint32_t>(freeIndices_.size()));
+    put(out, static_cast<uint32_t>(archetypes_.size()));
+    put(out, static_cast<uint64_t>(liveCount_));
+    putBytes(out, records_.data(), records_.size() * sizeof(Record));
+    putBytes(out, freeIndices_.data(), freeIndices_.size() * sizeof(uint32_t));
+
+    for (size_t i = 0; i < archetypes_.size(); ++i) {
+        const Archetype& a = archetypes_[i];
+        // Chunk-diff only against a base table with the same rows; otherwise write it whole.
+        const ArchetypeView* ba = (base && i < b.archetypes.size() && b.archetypes[i].count == a.count)
+                                ? &b.archetypes[i] : nullptr;
+        put(out, static_cast<uint32_t>(a.signature.size()));
+        put(out, a.count);
+        put(out, static_cast<uint32_t>(ba != nullptr));
+        for (ComponentId id : a.signature) put(out, id);
+        for (const Column& c : a.columns) put(out, c.size);
+        putBytes(out, a.entities.data(), a.entities.size() * sizeof(Entity));
+
+        for (size_t j = 0; j < a.columns.size(); ++j) {
+            const Column& c = a.columns[j];
+            const size_t bytes = static_cast<size_t>(a.count) * c.size;
+            if (!ba) { putBytes(out, c.data.data(), bytes); continue; }
+
+            const size_t countAt = out.size();
+            put(out, uint32_t{ 0 });
+            uint32_t written = 0;
+            const uint32_t chunks = static_cast<uint32_t>((bytes + kChunkBytes - 1) / kChunkBytes);
+            for (uint32_t k = 0; k < chunks; ++k) {
+                const size_t off = static_cast<size_t>(k) * kChunkBytes, len = chunkLength(bytes, k);
+                if (std::memcmp(c.data.data() + off, ba->columns[j].data + off, len) == 0) continue;
+                put(out, k);
+                putBytes(out, c.data.data() + off, len);
+                ++written;
+            }
+            std::memcpy(out.data() + countAt, &written, sizeof(written));
+        }
+    }
+
+    const size_t resCountAt = out.size();
+    put(out, uint32_t{ 0 });
+    uint32_t resCount = 0;
+    for (size_t id = 0; id < resources_.size(); ++id) {
+        const detail::ResourcePtr& res = resources_[id];
+        if (!res || res.get_deleter().podSize == 0) continue;
+        put(out, static_cast<uint32_t>(id));
+        put(out, res.get_deleter().podSize);
+        putBytes(out, res.get(), res.get_deleter().podSize);
+        ++resCount;
+    }
+    std::memcpy(out.data() + resCountAt, &resCount, sizeof(resCount));
+}
+
+void World::restore(const std::vector<std::byte>& in, const std::vector<std::byte>* base) {
+    const SnapshotView s = parse(in, sizeof(Record));
+    SnapshotView b;
+    if (s.kind == kDelta) {
+        require(base != nullptr, "restoring a delta snapshot needs its base");
+        b = parse(*base, sizeof(Record));
+        require(b.kind == kFull, "a delta's base must be a full snapshot");
+    }
+
+    // Validate against this world before writing anything, so a mismatch leaves it untouched.
+    for (size_t i = 0; i < s.archetypes.size(); ++i) {
+        const ArchetypeView& av = s.archetypes[i];
+        if (i < archetypes_.size()) {
+            const Archetype& a = archetypes_[i];
+            require(a.signature == av.signature, "archetype order does not match this world");
+            for (size_t j = 0; j < a.columns.size(); ++j)
+                require(a.columns[j].size == av.columns[j].size, "component size does not match this world");
+        } else {
+            // New tables must land at index i: none may already exist, or repeat an earlier one.
+            require(!archetypeIndex_.contains(av.signature), "archetype order does not match this world");
+            for (size_t k = archetypes_.size(); k < i; ++k)
+                require(s.archetypes[k].signature != av.signature, "archetype listed twice");
+        }
+        if (av.chunked) {
+            require(i < b.archetypes.size() && b.archetypes[i].signature == av.signature
+                        && b.archetypes[i].count == av.count,
+                    "delta does not match its base");
+            for (size_t j = 0; j < av.columns.size(); ++j)
+                require(b.archetypes[i].columns[j].size == av.columns[j].size, "delta does not match its base");
+        }
+    }
+    for (uint32_t k = 0; k < s.freeCount; ++k) {
+        uint32_t index;
+        std::memcpy(&index, s.freeIndices + static_cast<size_t>(k) * sizeof(uint32_t), sizeof(index));
+        require(index < s.recordCount, "free list entry out of range");
+    }
+
+    records_.resize(s.recordCount);
+    if (s.recordCount) std::memcpy(records_.data(), s.records, s.recordCount * sizeof(Record));
+    freeIndices_.resize(s.freeCount);
+    if (s.freeCount) std::memcpy(freeIndices_.data(), s.freeIndices, s.freeCount * sizeof(uint32_t));
+    liveCount_ = static_cast<size_t>(s.liveCount);
+
+    for (size_t i = 0; i < s.archetypes.size(); ++i) {
+        const ArchetypeView& av = s.archetypes[i];
+        if (i >= archetypes_.size()) {
+            std::vector<ComponentInfo> infos(av.signature.size());
+            for (size_t j = 0; j < infos.size(); ++j)
+                infos[j] = ComponentInfo{ av.signature[j], av.columns[j].size, 1 };
+            findOrCreateArchetype(infos.data(), infos.size());   // lands at index i (checked above)
+        }
+        Archetype& a = archetypes_[i];
+
+        a.count = av.count;
+        a.entities.resize(av.count);
+        if (av.count) std::memcpy(a.entities.data(), av.entities, av.count * sizeof(Entity));
+        for (size_t j = 0; j < a.columns.size(); ++j) {
+            Column& c = a.columns[j];
+            const size_t bytes = static_cast<size_t>(av.count) * c.size;
+            c.data.resize(bytes);
+            if (!av.chunked) {
+                if (bytes) std::memcpy(c.data.data(), av.columns[j].data, bytes);
+            } else {
+                if (bytes) std::memcpy(c.data.data(), b.archetypes[i].columns[j].data, bytes);
+                for (const auto& [k, p] : av.columns[j].chunks)
+                    std::memcpy(c.data.data() + static_cast<size_t>(k) * kChunkBytes, p, chunkLength(bytes, k));
+            }
+            c.ticks.assign(av.count, changeTick_);
+            c.changedTick = std::max(c.changedTick, changeTick_);
+        }
+    }
+    // Tables created after the snapshot stay (queries cache their indices) but hold no rows.
+    for (size_t i = s.archetypes.size(); i < archetypes_.size(); ++i) {
+        Archetype& a = archetypes_[i];
+        a.count = 0;
+        a.entities.clear();
+        for (Column& c : a.columns) { c.data.clear(); c.ticks.clear(); }
+    }
+
+    for (const ResourceView& rv : s.resources) {
+        if (rv.id >= resources_.size() || !resources_[rv.id]) continue;
+        if (resources_[rv.id].get_deleter().podSize != rv.size) continue;
+        std::memcpy(resources_[rv.id].get(), rv.data, rv.size);
+    }
+
+    ++structureVersion_;
+}
+
+} // namespace engine::ecs
@@ -20,6 +20,7 @@ uint32_t World::findOrCreateArchetype(const ComponentInfo* infos, size_t n) {
 
     Archetype a;
     a.signature = sig;
+    for (ComponentId cid : sig) a.mask.set(cid);
     a.columns.reserve(n);
     for (size_t i = 0; i < n; ++i) {
         Column c;
@@ -59,6 +60,7 @@ void World::destroy(Entity e) {
     rec.alive = false;
     ++rec.generation;         // invalidate outstanding handles to this entity
     --liveCount_;
+    ++structureVersion_;
     freeIndices_.push_back(e.index);
 }
 
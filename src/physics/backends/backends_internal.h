@@ -4,10 +4,12 @@
 //
 //  Per-backend factory makers, kept out of the public header. `createPhysicsWorld` (defined in the
 //  realtime TU) dispatches on `Backend` to one of these. Each backend TU defines its own maker.
+//  Also the small helpers the backends share.
 //
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "engine/physics/world.h"
@@ -17,4 +19,21 @@ namespace engine::physics {
 // Reduced-coordinate Featherstone/ABA backend (Phase E). Defined in reduced/featherstone_world.cpp.
 std::unique_ptr<PhysicsWorld> createFeatherstoneWorld(const WorldDef& def);
 
+// Stopwatch for the StepStats stage times: each lapMs() returns the time since the previous lap
+// (or restart()) — one steady_clock read per stage.
+class StageTimer {
+public:
+    void restart() { last_ = Clock::now(); }
+    double lapMs() {
+        const Clock::time_point now = Clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(now - last_).count();
+        last_ = now;
+        return ms;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point last_ = Clock::now();
+};
+
 } // namespace engine::physics
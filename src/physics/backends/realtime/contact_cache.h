@@ -0,0 +1,91 @@
+//
+//  contact_cache.h
+//  engine::physics / backends / realtime
+//
+//  Persistent per-contact / per-pair table: key → last value (a contact's solved normal impulse
+//  for warm-starting, a pair's GJK separating axis) + the step stamp that wrote it. Open
+//  addressing with linear probing over a power-of-two array (key 0 = empty slot), grown at 1/2
+//  load. find() is const and touches no shared state, so solver tasks may read it concurrently;
+//  store() and prune() are serial. prune() rebuilds into a spare array of the same capacity, so
+//  once the table has reached its working size a run allocates nothing.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "engine/physics/types.h"
+
+namespace engine::physics {
+
+template <class Value = Real>
+class ContactCache {
+public:
+    struct Entry {
+        uint64_t key = 0;
+        Value    value{};
+        uint32_t stamp = 0;
+    };
+
+    // The cached entry for `key` (non-zero), or nullptr.
+    const Entry* find(uint64_t key) const {
+        if (count_ == 0) return nullptr;
+        for (size_t i = slot(key);; i = (i + 1) & mask_) {
+            const Entry& e = slots_[i];
+            if (e.key == key) return &e;
+            if (e.key == 0) return nullptr;
+        }
+    }
+
+    // Inserts or overwrites `key` (non-zero).
+    void store(uint64_t key, const Value& value, uint32_t stamp) {
+        if (2 * (count_ + 1) > slots_.size()) grow();
+        size_t i = slot(key);
+        while (slots_[i].key != 0 && slots_[i].key != key) i = (i + 1) & mask_;
+        if (slots_[i].key == 0) ++count_;
+        slots_[i] = Entry{ key, value, stamp };
+    }
+
+    // Drops every entry for which keep(entry) is false.
+    template <class Keep>
+    void prune(Keep&& keep) {
+        spare_.assign(slots_.size(), Entry{});
+        slots_.swap(spare_);
+        count_ = 0;
+        for (const Entry& e : spare_)
+            if (e.key != 0 && keep(e)) insertFresh(e);
+    }
+
+    size_t size() const { return count_; }
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    std::vector<Entry> slots_, spare_;
+    size_t             mask_ = 0;
+    size_t             count_ = 0;
+
+    size_t slot(uint64_t key) const {
+        key ^= key >> 33; key *= 0xff51afd7ed558ccdull; key ^= key >> 33;   // murmur3 fmix64 (half)
+        return static_cast<size_t>(key) & mask_;
+    }
+
+    void insertFresh(const Entry& e) {   // key known absent, capacity known sufficient
+        size_t i = slot(e.key);
+        while (slots_[i].key != 0) i = (i + 1) & mask_;
+        slots_[i] = e;
+        ++count_;
+    }
+
+    void grow() {
+        spare_.assign(slots_.empty() ? 64 : 2 * slots_.size(), Entry{});
+        mask_ = spare_.size() - 1;
+        slots_.swap(spare_);
+        count_ = 0;
+        for (const Entry& e : spare_)
+            if (e.key != 0) insertFresh(e);
+    }
+};
+
+} // namespace engine::physics
@@ -0,0 +1,122 @@
+//
+//  joint_tree.h
+//  engine::physics / backends / realtime
+//
+//  Baraff's linear-time LDLᵀ ("Linear-Time Dynamics using Lagrange Multipliers", 1996) for a
+//  forest-structured symmetric block system. Nodes are stored children first (every parent has a
+//  higher index than its children); node i holds its diagonal block H_ii and the coupling block
+//  H_i,parent. factor() eliminates leaves upwards with no fill-in, solve() is one forward and one
+//  backward pass — both O(nodes). Blocks are a fixed 6×6: a smaller node pads its unused rows with
+//  an identity diagonal and zero couplings, which leaves those unknowns at zero.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "engine/physics/types.h"
+
+namespace engine::physics {
+
+class JointTree {
+public:
+    struct Block { Real m[6][6]; };   // row-major
+    struct Vec6  { Real v[6]; };
+
+    void resize(size_t n) {
+        parent_.resize(n);
+        diag_.resize(n);
+        edge_.resize(n);
+        inv_.resize(n);
+        l_.resize(n);
+    }
+
+    int32_t& parent(size_t i)  { return parent_[i]; }   // -1 for a root
+    Block&   diagonal(size_t i) { return diag_[i]; }    // H_ii
+    Block&   coupling(size_t i) { return edge_[i]; }    // H_i,parent(i)
+
+    // Factors nodes [begin, end) (a closed set of whole trees). False when a pivot vanishes
+    // (dependent constraint rows); the range must not be solved then.
+    bool factor(uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {   // D_i already holds its children's updates
+            if (!invert(diag_[i], inv_[i])) return false;
+            if (parent_[i] < 0) continue;
+            l_[i] = mul(inv_[i], edge_[i]);              // L_i = D_i⁻¹ H_i,p
+            subTransposeMul(diag_[parent_[i]], edge_[i], l_[i]);   // D_p -= H_i,pᵀ L_i
+        }
+        return true;
+    }
+
+    // Solves H x = b in place over a factored range.
+    void solve(uint32_t begin, uint32_t end, Vec6* x) const {
+        for (uint32_t i = begin; i < end; ++i)
+            if (parent_[i] >= 0) {
+                Vec6& xp = x[parent_[i]];
+                for (int r = 0; r < 6; ++r)
+                    for (int c = 0; c < 6; ++c) xp.v[r] -= l_[i].m[c][r] * x[i].v[c];   // -= L_iᵀ x_i
+            }
+        for (uint32_t i = end; i-- > begin;) {
+            Vec6 y{};
+            for (int r = 0; r < 6; ++r)
+                for (int c = 0; c < 6; ++c) y.v[r] += inv_[i].m[r][c] * x[i].v[c];
+            if (parent_[i] >= 0) {
+                const Vec6& xp = x[parent_[i]];
+                for (int r = 0; r < 6; ++r)
+                    for (int c = 0; c < 6; ++c) y.v[r] -= l_[i].m[r][c] * xp.v[c];
+            }
+            x[i] = y;
+        }
+    }
+
+private:
+    std::vector<int32_t> parent_;
+    std::vector<Block>   diag_, edge_, inv_, l_;
+
+    static Block mul(const Block& a, const Block& b) {
+        Block o{};
+        for (int r = 0; r < 6; ++r)
+            for (int k = 0; k < 6; ++k)
+                for (int c = 0; c < 6; ++c) o.m[r][c] += a.m[r][k] * b.m[k][c];
+        return o;
+    }
+
+    static void subTransposeMul(Block& d, const Block& e, const Block& l) {   // d -= eᵀ l
+        for (int r = 0; r < 6; ++r)
+            for (int k = 0; k < 6; ++k)
+                for (int c = 0; c < 6; ++c) d.m[r][c] -= e.m[k][r] * l.m[k][c];
+    }
+
+    // Gauss-Jordan with partial pivoting (joint blocks are negative definite, body blocks
+    // positive definite — both fine without symmetric pivoting).
+    static bool invert(Block a, Block& out) {
+        Block inv{};
+        for (int i = 0; i < 6; ++i) inv.m[i][i] = Real(1);
+        Real scale = Real(0);
+        for (int r = 0; r < 6; ++r)
+            for (int c = 0; c < 6; ++c) scale = std::max(scale, std::abs(a.m[r][c]));
+        const Real tiny = scale * Real(1e-9);
+        for (int c = 0; c < 6; ++c) {
+            int p = c;
+            for (int r = c + 1; r < 6; ++r)
+                if (std::abs(a.m[r][c]) > std::abs(a.m[p][c])) p = r;
+            if (!(std::abs(a.m[p][c]) > tiny)) return false;
+            if (p != c)
+                for (int k = 0; k < 6; ++k) { std::swap(a.m[p][k], a.m[c][k]); std::swap(inv.m[p][k], inv.m[c][k]); }
+            const Real s = Real(1) / a.m[c][c];
+            for (int k = 0; k < 6; ++k) { a.m[c][k] *= s; inv.m[c][k] *= s; }
+            for (int r = 0; r < 6; ++r) {
+                if (r == c || a.m[r][c] == Real(0)) continue;
+                const Real f = a.m[r][c];
+                for (int k = 0; k < 6; ++k) { a.m[r][k] -= f * a.m[c][k]; inv.m[r][k] -= f * inv.m[c][k]; }
+            }
+        }
+        out = inv;
+        return true;
+    }
+};
+
+} // namespace engine::physics
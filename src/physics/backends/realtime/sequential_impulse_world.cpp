@@ -13,49 +13,57 @@
 //
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "engine/core/threading/thread_pool.h"
 #include "engine/physics/broadphase/aabb.h"
+#include "engine/physics/broadphase/dynamic_tree.h"
+#include "engine/physics/broadphase/hierarchical_grid.h"
 #include "engine/physics/broadphase/sweep_and_prune.h"
 #include "engine/physics/broadphase/uniform_grid.h"
 #include "engine/physics/collision/box_box.h"
 #include "engine/physics/collision/capsule.h"
 #include "engine/physics/collision/convex.h"
 #include "engine/physics/collision/convex_manifold.h"
+#include "engine/physics/collision/gjk.h"
 #include "engine/physics/collision/primitives.h"
 #include "engine/physics/collision/support.h"
 #include "engine/physics/dynamics/body.h"
 #include "engine/physics/dynamics/integrate.h"
+#include "engine/physics/shapes/cooked_hull.h"
 #include "engine/physics/world.h"
 
 #include "engine/core/profile/profile.h"   // ENGINE_PROFILE_SCOPE — phase timing (compiled out in Release)
 
 #include "../backends_internal.h"
+#include "contact_cache.h"
+#include "joint_tree.h"
+#include "simd_lanes.h"
 
 namespace engine::physics {
 namespace {
 
 // Contact/joint solver tuning now lives in WorldDef::solver (engine/physics/config.h) — read via def_.
 
-struct BodyData {
-    Vec3            position{0};
-    Quat            orientation{1, 0, 0, 0};
-    Vec3            linVel{0};
-    Vec3            angVel{0};
-    Real            invMass = Real(0);
-    Mat3            invInertiaLocal{Real(0)};
+// Per-body storage is split by access pattern. The hot state every integration pass and solver
+// iteration streams through (pose, velocities, inverse mass/inertia) lives in parallel SoA arrays
+// on the world, indexed by body slot; the record below is the cold remainder, read only by
+// creation, the broadphase/narrowphase, filtering and handle validation.
+struct BodyCold {
     PhysicsMaterial material{};
     BodyType        type = BodyType::Static;
     ColliderDesc    collider{};
+    CookedHull      hull{};           // ConvexHull collider cooked at creation (empty if degenerate)
     uint32_t        collisionCategory = 0x0001;
     uint32_t        collisionMask     = 0xFFFFFFFFu;
-    uint32_t        generation = 0;
+    Real            invMass = 0;      // restored to the hot array on wake (sleepers read as static)
     bool            alive = false;
 };
 
@@ -65,22 +73,28 @@ struct Constraint {
     Vec3     point{0};
     Real     penetration = 0;    // > 0 when overlapping
     Real     restitutionBias = 0;
+    Real     friction = 0;           // combined sqrt(muA·muB), resolved at narrowphase
     Real     normalImpulse = 0;  // accumulated (within step)
-    Real     tangentImpulse = 0;
+    Vec3     tangentImpulse{0};  // accumulated friction impulse (tangent plane, |·| ≤ μ·normalImpulse)
     Real     pseudoImpulse = 0;  // accumulated position-correction (split-impulse) impulse
-    uint64_t key = 0;            // stable (bodyA,bodyB,contactIdx) id for contact warm-starting
+    uint64_t key = 0;            // stable (bodyA,bodyB,feature) id for contact warm-starting
 };
 
-// Per-candidate-pair narrowphase output (written to its own slot → lock-free parallel fill).
-// Holds a small manifold (e.g. box-plane resting yields up to 4 contacts).
+// Per-candidate-pair narrowphase header (written to its own slot → lock-free parallel fill). The
+// pair's manifold (≤ 4 points, e.g. box-plane resting) is staged in its 4 slots of the contact
+// staging array; only the first `count` are written, nothing is cleared between steps.
 struct PairResult {
-    int          count = 0;
-    Constraint   c[4];
-    ContactEvent e[4];
+    uint32_t a = 0, b = 0;           // contact normal points a -> b
+    uint32_t offset = 0;             // first output constraint (exclusive scan of count)
+    uint8_t  count = 0;
+    uint8_t  gjk = 0, epa = 0;       // GJK queries / EPA expansions run for the pair (StepStats)
+    uint8_t  axisHit = 0;            // the cached separating axis still separated (no GJK run)
+    uint8_t  axisOut = 0;            // the pair's separating-axis slot was written (store it)
 };
 
 // Persistent joint (Phase B). Unlike contacts (rebuilt each step), joints live across steps and
-// warm-start from their accumulated impulses. Solved serially in creation order (deterministic).
+// warm-start from their accumulated impulses. Solved color by color (see colorJoints), or by the
+// island's direct tree solve (WorldDef::directJointSolver).
 // Cached fields (rA/rB/K/bias) are recomputed each substep in prepareJoints(); the *Impulse
 // accumulators carry across steps for warm-starting.
 struct JointData {
@@ -110,10 +124,16 @@ struct JointData {
     Vec3      angBias{0};             // angular Baumgarte bias
     Real      kt1 = 0, kt2 = 0;       // scalar angular effective masses (hinge 2-axis)
     Real      kAxis = 0;              // scalar effective mass about the hinge axis (limit)
-    int       limitState = 0;         // 0 none, +1 at lower (push +), -1 at upper (push -)
-    Real      limitBias = 0;          // Baumgarte bias for an active limit
+    int       limitState = 0;         // 0 none, +1 toward lower (push +), -1 toward upper (push -)
+    Real      limitSpec = 0;          // speculative bias: the angle left before the limit, per h
+    Real      limitBias = 0;          // Baumgarte bias for a violated limit
+    // Split drift correction (splitJointDrift()): the biases above move here, are solved on the
+    // pseudo-velocity in the position pass, and are zero in the velocity solve.
+    Vec3      pointDrift{0}, angDrift{0};
+    Real      limitDrift = 0;
+    Real      limitPseudo = 0;        // accumulated pseudo-impulse of an active limit (one-sided)
+    bool      direct = false;         // equality rows solved by the island's JointTree this substep
 
-    uint32_t  generation = 0;
     bool      alive = false;
 };
 
@@ -121,7 +141,8 @@ class SequentialImpulseWorld final : public PhysicsWorld {
 public:
     explicit SequentialImpulseWorld(const WorldDef& def)
         : def_(def), pool_(def.threadPool),
-          threshold_(def.parallelThreshold > 0 ? static_cast<size_t>(def.parallelThreshold) : 1) {}
+          threshold_(def.parallelThreshold > 0 ? static_cast<size_t>(def.parallelThreshold) : 1),
+          tree_(def.solver.treeFatMargin) {}
 
     BodyHandle createBody(const BodyDef& d) override {
         uint32_t index;
@@ -129,46 +150,72 @@ public:
         else {
             index = static_cast<uint32_t>(bodies_.size());
             bodies_.emplace_back();
+            position_.emplace_back(0);
+            orientation_.emplace_back(1, 0, 0, 0);
+            linVel_.emplace_back(0);
+            angVel_.emplace_back(0);
+            invMass_.emplace_back(0);
+            invInertiaLocal_.emplace_back(Real(0));
+            moving_.emplace_back(0);
+            sleepTimer_.emplace_back(0);
+            sleepSet_.emplace_back(kNoSleepSet);
             poses_.emplace_back();
             linVelOut_.emplace_back(0);
             angVelOut_.emplace_back(0);
+            generation_.emplace_back(0);
         }
-        BodyData& b = bodies_[index];
-        b = BodyData{};
-        b.position = d.position;
-        b.orientation = d.orientation;
-        b.linVel = d.linearVelocity;
-        b.angVel = d.angularVelocity;
+        BodyCold& b = bodies_[index];
+        b = BodyCold{};
         b.material = d.material;
         b.type = d.type;
         b.collider = d.collider;
+        if (d.collider.type == ColliderDesc::Type::ConvexHull) cookHull(d.collider.convexHull.vertices, b.hull);
         b.collisionCategory = d.collisionCategory;
         b.collisionMask = d.collisionMask;
         b.alive = true;
 
+        position_[index] = d.position;
+        orientation_[index] = d.orientation;
+        linVel_[index] = d.linearVelocity;
+        angVel_[index] = d.angularVelocity;
+        moving_[index] = d.type != BodyType::Static;
+        sleepTimer_[index] = 0;
+        sleepSet_[index] = kNoSleepSet;
+
         const bool dynamic = (d.type == BodyType::Dynamic) && d.mass > kEpsilon;
-        b.invMass = dynamic ? Real(1) / d.mass : Real(0);
+        invMass_[index] = dynamic ? Real(1) / d.mass : Real(0);
+        b.invMass = invMass_[index];
+        Mat3& invI = invInertiaLocal_[index];
         if (dynamic && d.collider.type == ColliderDesc::Type::Sphere)
-            b.invInertiaLocal = solidSphereInvInertia(d.mass, d.collider.sphere.radius);
+            invI = solidSphereInvInertia(d.mass, d.collider.sphere.radius);
         else if (dynamic && d.collider.type == ColliderDesc::Type::Box)
-            b.invInertiaLocal = solidBoxInvInertia(d.mass, d.collider.box.halfExtents);
-        else if (dynamic && d.collider.type == ColliderDesc::Type::ConvexHull) {
+            invI = solidBoxInvInertia(d.mass, d.collider.box.halfExtents);
+        else if (dynamic && d.collider.type == ColliderDesc::Type::ConvexHull && !b.hull.empty()) {
+            // Exact solid inertia is about the hull centroid; the body turns about its origin, so
+            // shift it there (parallel axis: + m(|c|²·1 - c⊗c)).
+            const Vec3& c = b.hull.centroid;
+            const Mat3 shift = glm::dot(c, c) * Mat3(Real(1)) - glm::outerProduct(c, c);
+            invI = glm::inverse(d.mass * (b.hull.inertia + shift));
+        } else if (dynamic && d.collider.type == ColliderDesc::Type::ConvexHull) {
             Vec3 lo(1e30f), hi(-1e30f);
             for (const Vec3& v : d.collider.convexHull.vertices) { lo = glm::min(lo, v); hi = glm::max(hi, v); }
-            b.invInertiaLocal = solidBoxInvInertia(d.mass, (hi - lo) * Real(0.5));   // AABB approx
+            invI = solidBoxInvInertia(d.mass, (hi - lo) * Real(0.5));   // AABB approx
         } else if (dynamic && d.collider.type == ColliderDesc::Type::Capsule)
-            b.invInertiaLocal = solidCapsuleInvInertia(d.mass, d.collider.capsule.radius, d.collider.capsule.halfHeight);
+            invI = solidCapsuleInvInertia(d.mass, d.collider.capsule.radius, d.collider.capsule.halfHeight);
         else
-            b.invInertiaLocal = Mat3(Real(0));
+            invI = Mat3(Real(0));
 
         writeOutputs(index);
-        return BodyHandle{ index, b.generation };
+        return BodyHandle{ index, generation_[index] };
     }
 
     void destroyBody(BodyHandle h) override {
         if (!valid(h)) return;
+        wakeTouching(h.index);   // sleeping neighbours lose their support
         bodies_[h.index].alive = false;
-        ++bodies_[h.index].generation;
+        ++generation_[h.index];   // outlives the slot: stale handles never match a reuse
+        invMass_[h.index] = Real(0);   // dead slots drop out of every dynamic/moving pass
+        moving_[h.index] = 0;
         freeList_.push_back(h.index);
     }
 
@@ -176,12 +223,10 @@ public:
         if (!valid(d.a) || !valid(d.b)) return JointHandle{};
         uint32_t index;
         if (!jointFreeList_.empty()) { index = jointFreeList_.back(); jointFreeList_.pop_back(); }
-        else { index = static_cast<uint32_t>(joints_.size()); joints_.emplace_back(); }
+        else { index = static_cast<uint32_t>(joints_.size()); joints_.emplace_back(); jointGeneration_.emplace_back(0); }
 
         JointData& j = joints_[index];
-        const uint32_t gen = j.generation;   // preserve generation across slot reuse
-        j = JointData{};
-        j.generation = gen;
+        j = JointData{};   // jointGeneration_ survives slot reuse
         j.type = d.type;
         j.a = d.a.index;
         j.b = d.b.index;
@@ -194,40 +239,53 @@ public:
         j.upperLimit = d.upperLimit;
         j.actuator = d.actuator;
         // Reference relative orientation qA*·qB, captured at creation (Fixed keeps this).
-        j.refRel = glm::normalize(glm::conjugate(bodies_[j.a].orientation) * bodies_[j.b].orientation);
+        j.refRel = glm::normalize(glm::conjugate(orientation_[j.a]) * orientation_[j.b]);
         j.alive = true;
-        return JointHandle{ index, j.generation };
+        wakeJoint(j);
+        return JointHandle{ index, jointGeneration_[index] };
     }
 
     void destroyJoint(JointHandle h) override {
         if (!jointValid(h)) return;
+        wakeJoint(joints_[h.index]);
         joints_[h.index].alive = false;
-        ++joints_[h.index].generation;
+        ++jointGeneration_[h.index];   // outlives the slot, like generation_
         jointFreeList_.push_back(h.index);
     }
 
+    // Actuator commands wake the joint's island (bulk writes only when the command changed).
     void setJointActuator(JointHandle h, const Actuator& a) override {
-        if (jointValid(h)) joints_[h.index].actuator = a;
+        if (jointValid(h)) { joints_[h.index].actuator = a; wakeJoint(joints_[h.index]); }
     }
     void setJointTarget(JointHandle h, Real target) override {
-        if (jointValid(h)) joints_[h.index].actuator.target = target;
+        if (jointValid(h)) { joints_[h.index].actuator.target = target; wakeJoint(joints_[h.index]); }
     }
     void setJointTorque(JointHandle h, Real torque) override {
-        if (jointValid(h)) joints_[h.index].actuator.torque = torque;
+        if (jointValid(h)) { joints_[h.index].actuator.torque = torque; wakeJoint(joints_[h.index]); }
     }
     void setJointBallTorque(JointHandle h, Vec3 torque) override {
-        if (jointValid(h)) joints_[h.index].actuator.ballTorque = torque;
+        if (jointValid(h)) { joints_[h.index].actuator.ballTorque = torque; wakeJoint(joints_[h.index]); }
     }
     void setJointBallTarget(JointHandle h, Quat target) override {
-        if (jointValid(h)) joints_[h.index].actuator.ballTarget = glm::normalize(target);
+        if (jointValid(h)) { joints_[h.index].actuator.ballTarget = glm::normalize(target); wakeJoint(joints_[h.index]); }
     }
     void setJointTargets(std::span<const Real> targets) override {
         const size_t n = std::min(targets.size(), joints_.size());
-        for (size_t i = 0; i < n; ++i) if (joints_[i].alive) joints_[i].actuator.target = targets[i];
+        for (size_t i = 0; i < n; ++i) {
+            JointData& j = joints_[i];
+            if (!j.alive) continue;
+            if (numSleeping_ > 0 && j.actuator.target != targets[i]) wakeJoint(j);
+            j.actuator.target = targets[i];
+        }
     }
     void setJointTorques(std::span<const Real> torques) override {
         const size_t n = std::min(torques.size(), joints_.size());
-        for (size_t i = 0; i < n; ++i) if (joints_[i].alive) joints_[i].actuator.torque = torques[i];
+        for (size_t i = 0; i < n; ++i) {
+            JointData& j = joints_[i];
+            if (!j.alive) continue;
+            if (numSleeping_ > 0 && j.actuator.torque != torques[i]) wakeJoint(j);
+            j.actuator.torque = torques[i];
+        }
     }
     JointState jointState(JointHandle h) const override {
         if (!jointValid(h) || joints_[h.index].type != JointType::Revolute) return {};
@@ -239,8 +297,9 @@ public:
     void setBodyState(BodyHandle h, const Vec3& p, const Quat& q, const Vec3& lv,
                       const Vec3& av) override {
         if (!valid(h)) return;
-        BodyData& b = bodies_[h.index];
-        b.position = p; b.orientation = q; b.linVel = lv; b.angVel = av;
+        wakeTouching(h.index);
+        position_[h.index] = p; orientation_[h.index] = q; linVel_[h.index] = lv; angVel_[h.index] = av;
+        sleepTimer_[h.index] = 0;
         writeOutputs(h.index);
     }
     void clearState() override {
@@ -256,11 +315,12 @@ public:
                               std::span<const Vec3> linVel,
                               std::span<const Vec3> angVel) override {
         const size_t n = std::min({ poses.size(), linVel.size(), angVel.size(), bodies_.size() });
+        wakeAll();
         for (size_t i = 0; i < n; ++i) {
-            BodyData& b = bodies_[i];
+            const BodyCold& b = bodies_[i];
             if (!b.alive || b.type != BodyType::Dynamic) continue;
-            b.position = poses[i].position; b.orientation = glm::normalize(poses[i].rotation);
-            b.linVel = linVel[i]; b.angVel = angVel[i];
+            position_[i] = poses[i].position; orientation_[i] = glm::normalize(poses[i].rotation);
+            linVel_[i] = linVel[i]; angVel_[i] = angVel[i];
         }
         refreshState();
     }
@@ -276,20 +336,31 @@ public:
         const Real h = dt / static_cast<Real>(substeps);
         kSubDt_ = h;
         events_.clear();
+        stats_ = StepStats{};
+        StageTimer total;
+        timer_.restart();
 
         // Warm-start bookkeeping: a fresh stamp per step (all substeps write it); lazily drop cached
         // contacts not seen for a few steps so the map doesn't accumulate dead keys over a long run.
         ++contactStamp_;
+        // Contacts of sleeping bodies are kept: they warm-start the island when it wakes.
         if (def_.contactWarmStart && (contactStamp_ & 0x7F) == 0) {
-            for (auto it = contactCache_.begin(); it != contactCache_.end();)
-                it = (contactStamp_ - it->second.stamp > 4u) ? contactCache_.erase(it) : std::next(it);
+            contactCache_.prune([&](const ContactCache<>::Entry& e) {
+                return contactStamp_ - e.stamp <= 4u
+                    || asleep(static_cast<uint32_t>(e.key >> 40))
+                    || asleep(static_cast<uint32_t>((e.key >> 16) & 0xFFFFFFu));
+            });
         }
+        if ((contactStamp_ & 0x7F) == 0)
+            axisCache_.prune([&](const ContactCache<Vec3>::Entry& e) { return contactStamp_ - e.stamp <= 4u; });
 
         // TGS-Soft path: separate substep loop (manifold built once + reused, soft constraints).
         if (def_.contactSolver == ContactSolver::TGSSoft) {
             stepTgsSubsteps(dt);
+            if (def_.allowSleep) { buildIslands(); updateSleep(dt); }
             for (uint32_t i = 0; i < bodies_.size(); ++i) writeOutputs(i);
             writeJointStates();
+            stats_.totalMs = total.lapMs();
             return;
         }
 
@@ -301,8 +372,9 @@ public:
             computeWorldInvInertia();
 
             // 1. Integrate velocities (gravity) + apply joint actuator torques (B3).
-            forEachDynamic([&](BodyData& b) { b.linVel += def_.gravity * h; });
+            forEachDynamic([&](size_t i) { linVel_[i] += def_.gravity * h; });
             applyActuators(h);
+            stats_.integrateMs += timer_.lapMs();
 
             // 2. Broadphase + narrowphase -> constraints.
             { ENGINE_PROFILE_SCOPE("phys.build"); buildConstraints(h); }
@@ -310,33 +382,41 @@ public:
             // 2b. Joints: cache per-substep solve data + warm-start from accumulated impulses.
             prepareJoints(h);
 
-            // 3. Sequential-impulse velocity solve. Joints solved serially (creation order,
-            //    deterministic) before the graph-colored contacts each iteration.
+            // 2c. Islands: union-find over contacts + joints → independent solve tasks.
+            { ENGINE_PROFILE_SCOPE("phys.islands"); buildIslands(); }
+            stats_.islands = std::max(stats_.islands, static_cast<int>(largeIslands_.size() + batchIslands_.size()));
+            stats_.jointColors = std::max(stats_.jointColors, static_cast<int>(numJointColors_));
+            stats_.graphMs += timer_.lapMs();
+
+            // 3. Sequential-impulse velocity solve, island by island. Within an island, the
+            //    graph-colored joints are solved before the graph-colored contacts each iteration.
+            //    Islands share no dynamic body, so this equals one global sweep in that order, for
+            //    any pool size (deterministic).
             {
                 ENGINE_PROFILE_SCOPE("phys.solve");
-                warmStartColored();                    // seed contact impulses from the prior solution
-                for (int it = 0; it < def_.velocityIterations; ++it) {
-                    solveJoints();
-                    solveColored();
-                }
+                forEachIsland([&](uint32_t k, bool par) { solveIslandVelocity(k, par); });
                 storeContactImpulses();                // cache solved impulses for next substep/step
+                gatherIslandStats(stats_.velocityIterations, stats_.velocitySweeps, stats_.velocityResidual);
             }
 
-            // 3a. Split-impulse position correction: depenetrate on a separate pseudo-velocity
-            //     (biasLin_/biasAng_), reset each substep, that moves positions in step 4 but never
-            //     feeds the real velocity → no Baumgarte energy injection. Contacts only.
+            // 3a. Split-impulse position correction: depenetrate contacts and pull joints back
+            //     together on a separate pseudo-velocity (biasLin_/biasAng_), reset each substep,
+            //     that moves positions in step 4 but never feeds the real velocity → no Baumgarte
+            //     energy injection.
             biasLin_.assign(bodies_.size(), Vec3(0));
             biasAng_.assign(bodies_.size(), Vec3(0));
-            if (def_.splitImpulse && def_.positionIterations > 0 && !constraints_.empty()) {
+            if (def_.splitImpulse && def_.positionIterations > 0 && (!constraints_.empty() || !islandJoints_.empty())) {
                 ENGINE_PROFILE_SCOPE("phys.position");
-                for (int it = 0; it < def_.positionIterations; ++it) solvePositionColored();
+                forEachIsland([&](uint32_t k, bool par) { solveIslandPosition(k, par); });
+                gatherIslandStats(stats_.positionIterations, stats_.positionSweeps, stats_.positionResidual);
             }
+            stats_.solveMs += timer_.lapMs();
 
             // 3b. Optional velocity damping (drag) on dynamic bodies, so undamped DOFs settle.
             if (def_.linearDamping > Real(0) || def_.angularDamping > Real(0)) {
                 const Real ld = std::max(Real(0), Real(1) - def_.linearDamping * h);
                 const Real ad = std::max(Real(0), Real(1) - def_.angularDamping * h);
-                forEachDynamic([&](BodyData& b) { b.linVel *= ld; b.angVel *= ad; });
+                forEachDynamic([&](size_t i) { linVel_[i] *= ld; angVel_[i] *= ad; });
             }
 
             // 4. Integrate positions + orientations (Dynamic + Kinematic). Dynamic bodies advance by
@@ -346,23 +426,27 @@ public:
                 ENGINE_PROFILE_SCOPE("phys.integrate");
                 const size_t nb = bodies_.size();
                 auto integrateOne = [&](size_t i) {
-                    BodyData& b = bodies_[i];
-                    if (!b.alive || b.type == BodyType::Static) return;
-                    b.position += (b.linVel + biasLin_[i]) * h;
-                    b.orientation = integrateOrientation(b.orientation, b.angVel + biasAng_[i], h);
+                    if (!moving_[i]) return;
+                    position_[i] += (linVel_[i] + biasLin_[i]) * h;
+                    orientation_[i] = integrateOrientation(orientation_[i], angVel_[i] + biasAng_[i], h);
                 };
                 if (pool_ && nb >= threshold_) pool_->parallelFor(nb, integrateOne, 1024);
                 else for (size_t i = 0; i < nb; ++i) integrateOne(i);
             }
+            stats_.integrateMs += timer_.lapMs();
         }
 
+        if (def_.allowSleep) updateSleep(dt);
         for (uint32_t i = 0; i < bodies_.size(); ++i) writeOutputs(i);
         writeJointStates();
+        stats_.totalMs = total.lapMs();
     }
 
     std::span<const engine::Transform> poses() const override { return poses_; }
     std::span<const Vec3> linearVelocities() const override { return linVelOut_; }
     std::span<const Vec3> angularVelocities() const override { return angVelOut_; }
+    std::span<const uint32_t> bodyGenerations() const override { return generation_; }
+    std::span<const uint32_t> jointGenerations() const override { return jointGeneration_; }
 
     engine::Transform pose(BodyHandle h) const override {
         if (!valid(h)) return {};
@@ -370,56 +454,40 @@ public:
     }
 
     std::span<const ContactEvent> contacts() const override { return events_; }
+    const StepStats& stepStats() const override { return stats_; }
 
 private:
     bool valid(BodyHandle h) const {
         return h.valid() && h.index < bodies_.size() && bodies_[h.index].alive
-            && bodies_[h.index].generation == h.generation;
+            && generation_[h.index] == h.generation;
     }
 
     bool jointValid(JointHandle h) const {
         return h.valid() && h.index < joints_.size() && joints_[h.index].alive
-            && joints_[h.index].generation == h.generation;
+            && jointGeneration_[h.index] == h.generation;
     }
 
     // Category/mask collision filter (B4): both directions must pass. Lets an articulation's
     // jointed limbs (same category, masking that category out) skip colliding with each other.
-    static bool collisionFilter(const BodyData& A, const BodyData& B) {
+    static bool collisionFilter(const BodyCold& A, const BodyCold& B) {
         return (A.collisionCategory & B.collisionMask) != 0u
             && (B.collisionCategory & A.collisionMask) != 0u;
     }
     void writeOutputs(uint32_t i) {
-        const BodyData& b = bodies_[i];
-        poses_[i].position = b.position;
-        poses_[i].rotation = b.orientation;
+        poses_[i].position = position_[i];
+        poses_[i].rotation = orientation_[i];
         poses_[i].scale = Vec3(1);
-        linVelOut_[i] = b.linVel;
-        angVelOut_[i] = b.angVel;
+        linVelOut_[i] = linVel_[i];
+        angVelOut_[i] = angVel_[i];
     }
 
-    // Applies `f(body)` to each alive dynamic body, in parallel when the pool is set and the
-    // body count is large (writes touch disjoint bodies → deterministic).
+    // Applies `f(i)` to each alive dynamic body slot, in parallel when the pool is set and the
+    // body count is large (writes touch disjoint bodies → deterministic). Dead slots have
+    // invMass 0, so this reads only the hot arrays.
     template <class F>
     void forEachDynamic(F&& f) {
-        const size_t n = bodies_.size();
-        auto one = [&](size_t i) {
-            BodyData& b = bodies_[i];
-            if (b.alive && b.invMass != Real(0)) f(b);
-        };
-        if (pool_ && n >= threshold_) pool_->parallelFor(n, one, 1024);
-        else for (size_t i = 0; i < n; ++i) one(i);
-    }
-
-    // Applies `f(body)` to each alive body that is integrated (Dynamic + Kinematic). Kinematic
-    // bodies have invMass==0 (never pushed by the solver) but DO advance by their scripted
-    // velocity, so they must be integrated even though forEachDynamic skips them.
-    template <class F>
-    void forEachMoving(F&& f) {
-        const size_t n = bodies_.size();
-        auto one = [&](size_t i) {
-            BodyData& b = bodies_[i];
-            if (b.alive && b.type != BodyType::Static) f(b);
-        };
+        const size_t n = invMass_.size();
+        auto one = [&](size_t i) { if (invMass_[i] != Real(0)) f(i); };
         if (pool_ && n >= threshold_) pool_->parallelFor(n, one, 1024);
         else for (size_t i = 0; i < n; ++i) one(i);
     }
@@ -428,11 +496,9 @@ private:
     // contact + joint + actuator + limit solves. Dead/static bodies get 0 (never written anyway).
     void computeWorldInvInertia() {
         worldInvInertia_.resize(bodies_.size());
-        for (size_t i = 0; i < bodies_.size(); ++i) {
-            const BodyData& b = bodies_[i];
-            worldInvInertia_[i] = (b.alive && b.invMass != Real(0))
-                ? worldInvInertia(b.orientation, b.invInertiaLocal) : Mat3(Real(0));
-        }
+        for (size_t i = 0; i < bodies_.size(); ++i)
+            worldInvInertia_[i] = (invMass_[i] != Real(0))
+                ? worldInvInertia(orientation_[i], invInertiaLocal_[i]) : Mat3(Real(0));
     }
 
     // Fills constraints_ for the current configuration. normal always points a -> b. Finite
@@ -440,38 +506,50 @@ private:
     // tested against every finite body directly. Narrowphase is parallelized over candidate
     // pairs (each writes its own slot); compaction is serial in candidate order → deterministic.
     void buildConstraints(Real h) {
+        substepEventBegin_ = events_.size();
         constraints_.clear();
         finiteIdx_.clear();
         finiteAabb_.clear();
         planeIdx_.clear();
 
         for (uint32_t i = 0; i < bodies_.size(); ++i) {
-            const BodyData& b = bodies_[i];
+            const BodyCold& b = bodies_[i];
             if (!b.alive) continue;
+            const Vec3& pos = position_[i];
             Aabb box;
             bool finite = true;
             if (b.collider.type == ColliderDesc::Type::Sphere) {
-                box = Aabb::fromSphere(b.position, b.collider.sphere.radius);
+                box = Aabb::fromSphere(pos, b.collider.sphere.radius);
             } else if (b.collider.type == ColliderDesc::Type::Box) {
-                const Mat3 R = glm::mat3_cast(b.orientation);
+                const Mat3 R = glm::mat3_cast(orientation_[i]);
                 Mat3 absR;
                 for (int cc = 0; cc < 3; ++cc)
                     for (int rr = 0; rr < 3; ++rr) absR[cc][rr] = std::fabs(R[cc][rr]);
                 const Vec3 ext = absR * b.collider.box.halfExtents;
-                box = Aabb{ b.position - ext, b.position + ext };
+                box = Aabb{ pos - ext, pos + ext };
+            } else if (b.collider.type == ColliderDesc::Type::ConvexHull && !b.hull.empty()) {
+                const SupportShape s = supportOf(i);   // six hill-climbs instead of a vertex sweep
+                Vec3 lo, hi;
+                for (int k = 0; k < 3; ++k) {
+                    Vec3 d(0);
+                    d[k] = 1;
+                    hi[k] = s.support(d)[k];
+                    lo[k] = s.support(-d)[k];
+                }
+                box = Aabb{ lo, hi };
             } else if (b.collider.type == ColliderDesc::Type::ConvexHull) {
-                const Mat3 R = glm::mat3_cast(b.orientation);
+                const Mat3 R = glm::mat3_cast(orientation_[i]);
                 Vec3 lo(1e30f), hi(-1e30f);
                 for (const Vec3& v : b.collider.convexHull.vertices) {
-                    const Vec3 w = b.position + R * v;
+                    const Vec3 w = pos + R * v;
                     lo = glm::min(lo, w); hi = glm::max(hi, w);
                 }
                 box = Aabb{ lo, hi };
             } else if (b.collider.type == ColliderDesc::Type::Capsule) {
-                const Vec3 axis = b.orientation * Vec3(0, b.collider.capsule.halfHeight, 0);
+                const Vec3 axis = orientation_[i] * Vec3(0, b.collider.capsule.halfHeight, 0);
                 const Vec3 r(b.collider.capsule.radius);
-                box = Aabb{ glm::min(b.position - axis, b.position + axis) - r,
-                            glm::max(b.position - axis, b.position + axis) + r };
+                box = Aabb{ glm::min(pos - axis, pos + axis) - r,
+                            glm::max(pos - axis, pos + axis) + r };
             } else {   // Plane (infinite half-space) — tested against every finite body directly
                 planeIdx_.push_back(i);
                 finite = false;
@@ -479,7 +557,7 @@ private:
             if (!finite) continue;
 
             if (def_.continuousDetection && b.type != BodyType::Static) {   // swept AABB (CCD)
-                const Vec3 d = b.linVel * h;
+                const Vec3 d = linVel_[i] * h;
                 box.min += glm::min(d, Vec3(0));
                 box.max += glm::max(d, Vec3(0));
             }
@@ -488,70 +566,272 @@ private:
             finiteAabb_.push_back(box);
         }
 
-        if (def_.broadphase == BroadphaseKind::UniformGrid)
-            { ENGINE_PROFILE_SCOPE("phys.broadphase"); broadphase::uniformGrid(finiteAabb_, pairs_, pool_); }
-        else
-            { ENGINE_PROFILE_SCOPE("phys.broadphase"); broadphase::sweepAndPrune(finiteAabb_, pairs_); }
+        {
+            ENGINE_PROFILE_SCOPE("phys.broadphase");
+            switch (def_.broadphase) {
+            case BroadphaseKind::UniformGrid:      broadphase::uniformGrid(finiteAabb_, pairs_, pool_); break;
+            case BroadphaseKind::SweepAndPrune:    broadphase::sweepAndPrune(finiteAabb_, pairs_); break;
+            case BroadphaseKind::DynamicTree:      tree_.update(finiteIdx_, finiteAabb_, pairs_); break;   // keyed by slot
+            case BroadphaseKind::HierarchicalGrid: broadphase::hierarchicalGrid(finiteAabb_, pairs_, pool_); break;
+            }
+        }
+        stats_.broadphaseMs += timer_.lapMs();
+
+        if (numSleeping_ > 0) wakeTouched();
 
-        // Candidate body-index pairs: finite-finite (from broadphase) + plane-finite.
+        // Candidate body-index pairs: finite-finite (from broadphase) + plane-finite. Sleeping
+        // bodies read as static (invMass 0), so pairs among sleepers and static bodies drop out.
         candidatePairs_.clear();
         for (const auto& [pa, pb] : pairs_) {
             const uint32_t i = finiteIdx_[pa];
             const uint32_t j = finiteIdx_[pb];
-            if (bodies_[i].invMass == Real(0) && bodies_[j].invMass == Real(0)) continue;
+            if (invMass_[i] == Real(0) && invMass_[j] == Real(0)) continue;
             if (!collisionFilter(bodies_[i], bodies_[j])) continue;
             candidatePairs_.emplace_back(i, j);
         }
         for (uint32_t p : planeIdx_)
             for (uint32_t f : finiteIdx_) {
-                if (bodies_[p].invMass == Real(0) && bodies_[f].invMass == Real(0)) continue;
+                if (invMass_[p] == Real(0) && invMass_[f] == Real(0)) continue;
                 if (!collisionFilter(bodies_[p], bodies_[f])) continue;
                 candidatePairs_.emplace_back(p, f);
             }
 
         const size_t m = candidatePairs_.size();
-        perPair_.assign(m, PairResult{});
-        auto doPair = [&](size_t k) {
-            narrowphase(candidatePairs_[k].first, candidatePairs_[k].second, h, perPair_[k]);
-        };
+        perPair_.resize(m);   // every pair writes its whole header; nothing to clear
+        pairContacts_.resize(4 * m);
+        pairAxis_.resize(m);   // written only by pairs that set axisOut; stale otherwise
+        bucketPairs();
         {
             ENGINE_PROFILE_SCOPE("phys.narrowphase");
-            if (pool_ && m >= threshold_) pool_->parallelFor(m, doPair, 256);
-            else for (size_t k = 0; k < m; ++k) doPair(k);
+            const bool par = pool_ && m >= threshold_;
+            for (int kind = 0; kind < kPairKinds; ++kind) {
+                const uint32_t* idx = pairOrder_.data() + pairKindStart_[kind];
+                const size_t n = pairKindStart_[kind + 1] - pairKindStart_[kind];
+                if (kind == kGenericPair) {
+                    auto doPair = [&](size_t t) {
+                        const auto [i, j] = candidatePairs_[idx[t]];
+                        narrowphase(i, j, h, perPair_[idx[t]], &pairContacts_[4 * size_t(idx[t])], pairAxis_[idx[t]]);
+                    };
+                    if (par) pool_->parallelFor(n, doPair, 256);
+                    else for (size_t t = 0; t < n; ++t) doPair(t);
+                } else {
+                    auto doBatch = [&](size_t b) {
+                        narrowphaseLanes(static_cast<PairKind>(kind), idx + b * kLanes,
+                                         static_cast<int>(std::min<size_t>(kLanes, n - b * kLanes)), h);
+                    };
+                    const size_t batches = (n + kLanes - 1) / kLanes;
+                    if (par) pool_->parallelFor(batches, doBatch, 256 / kLanes);
+                    else for (size_t b = 0; b < batches; ++b) doBatch(b);
+                }
+            }
         }
 
-        for (size_t k = 0; k < m; ++k)
-            for (int t = 0; t < perPair_[k].count; ++t) {
-                constraints_.push_back(perPair_[k].c[t]);
-                events_.push_back(perPair_[k].e[t]);
+        // Count → scan → write: the scan over the small headers fixes each pair's output range
+        // (candidate order, as before), then the pairs build their constraints and events straight
+        // into place in parallel. Traffic scales with the contacts found, not with the candidates.
+        // The same serial pass files the separating axes the pairs wrote (axisOut).
+        uint32_t total = 0;
+        for (size_t k = 0; k < m; ++k) {
+            PairResult& r = perPair_[k];
+            r.offset = total;
+            total += r.count;
+            stats_.gjkCalls += r.gjk;
+            stats_.epaCalls += r.epa;
+            stats_.gjkAxisHits += r.axisHit;
+            const auto [i, j] = candidatePairs_[k];
+            if (r.axisOut) axisCache_.store(pairKey(i, j), pairAxis_[k], contactStamp_);
+        }
+        constraints_.resize(total);
+        const size_t eventBase = events_.size();
+        if (def_.contactEvents) events_.resize(eventBase + total);
+        auto writePair = [&](size_t k) {
+            const PairResult& r = perPair_[k];
+            for (uint32_t t = 0; t < r.count; ++t) {
+                const Contact& c = pairContacts_[4 * k + t];
+                Constraint& con = constraints_[r.offset + t];
+                con = makeConstraint(r.a, r.b, c, t);
+                if (def_.contactEvents)
+                    events_[eventBase + r.offset + t] = ContactEvent{
+                        BodyHandle{ r.a, generation_[r.a] }, BodyHandle{ r.b, generation_[r.b] },
+                        con.point, con.normal, c.separation };
             }
+        };
+        if (pool_ && m >= threshold_) pool_->parallelFor(m, writePair, 256);
+        else for (size_t k = 0; k < m; ++k) writePair(k);
+        stats_.candidatePairs += static_cast<long>(m);
+        stats_.contacts += static_cast<long>(constraints_.size());
+        stats_.narrowphaseMs += timer_.lapMs();
 
         colorConstraints();
+        stats_.contactColors = std::max(stats_.contactColors, static_cast<int>(numColors_));
+        stats_.graphMs += timer_.lapMs();
+    }
+
+    // ---- Graph coloring ----
+    // Two constraints get the same color only if they share no *dynamic* body (static bodies are
+    // never written, so they don't conflict); constraints of one color touch disjoint dynamic
+    // bodies → they can be solved in parallel.
+    //  * Jones-Plassmann over the body → constraint lists: each body's constraints are sorted by a
+    //    hashed priority, and a constraint is colored once it heads the list of every dynamic body
+    //    it touches — i.e. all its higher-priority neighbours are colored. Each round colors that
+    //    frontier in parallel (members share no body, so each owns its bodies' color masks and list
+    //    heads), then collects the new heads that became ready. The result depends on the graph
+    //    alone, so the serial and pooled paths agree bit for bit.
+    //  * Serial tail: constraints on a hub body (>= kHubDegree constraints, e.g. a heavy box under a
+    //    pile) would need one color per hub constraint; they go to one last color instead, solved
+    //    serially (tailColor_), and take no part in the coloring. Every other body then has < 64
+    //    constraints, so a constraint always finds a free color below 128 (two mask words).
+    //  * Balancing: constraints of colors above the mean size then move, in index order, to the
+    //    smallest below-mean color free on their bodies.
+    static constexpr uint32_t kNoColor = ~0u;
+    static constexpr uint32_t kHubMark = kNoColor - 1;   // tail constraint, before tailColor_ is known
+    static constexpr uint32_t kHubDegree = 64;
+
+    // Priority: a hash of index / 16. Runs of 16 consecutive constraints (mostly neighbouring
+    // contacts) keep index order, which keeps the rounds' memory access local; the hash across runs
+    // keeps frontiers wide. Ties go to the lower index.
+    static uint32_t colorPriority(uint32_t i) {
+        i = (i >> 4) * 0x9E3779B1u;
+        i ^= i >> 15; i *= 0x2C1B3C6Du; i ^= i >> 12;
+        return i;
+    }
+
+    using ColorMask = std::array<uint64_t, 2>;
+
+    static uint32_t lowestFree(const ColorMask& m) {
+        return ~m[0] != 0 ? static_cast<uint32_t>(std::countr_one(m[0]))
+                          : 64 + static_cast<uint32_t>(std::countr_one(m[1]));
+    }
+    static bool holds(const ColorMask& m, uint32_t col) { return m[col / 64] >> (col % 64) & 1u; }
+    static void flip(ColorMask& m, uint32_t col) { m[col / 64] ^= 1ull << (col % 64); }
+
+    ColorMask usedColors(uint32_t i) const {   // colors taken on constraint i's bodies
+        ColorMask m{};
+        for (const uint32_t body : conEnds_[i])
+            if (body != kNoColor) { m[0] |= bodyColorMask_[body][0]; m[1] |= bodyColorMask_[body][1]; }
+        return m;
+    }
+
+    // The constraint at the head of `body`'s list (kNoColor when exhausted).
+    uint32_t headOf(uint32_t body) const {
+        return bodyHead_[body] < bodyConStart_[body + 1] ? bodyCons_[bodyHead_[body]] : kNoColor;
+    }
+    bool colorReady(uint32_t i) const {
+        const auto [a, b] = conEnds_[i];
+        return (a == kNoColor || headOf(a) == i) && (b == kNoColor || headOf(b) == i);
     }
 
-    // Greedy graph-coloring of the contact graph: two constraints get the same color only if
-    // they share no *dynamic* body (static bodies are never written, so they don't conflict).
-    // Constraints of one color touch disjoint dynamic bodies → they can be solved in parallel.
-    // Coloring + the resulting solve order are deterministic (fixed constraint order), so the
-    // serial and pooled paths produce identical results.
     void colorConstraints() {
-        const size_t k = constraints_.size();
-        constraintColor_.assign(k, 0);
-        bodyColorMask_.assign(bodies_.size(), 0);
-        numColors_ = 0;
+        const uint32_t k = static_cast<uint32_t>(constraints_.size());
+        const uint32_t nb = static_cast<uint32_t>(bodies_.size());
+        const bool par = pool_ && k >= threshold_;
+        auto forAll = [&](size_t count, auto&& f) {
+            if (par) pool_->parallelFor(count, f, 256);
+            else for (size_t t = 0; t < count; ++t) f(t);
+        };
 
-        for (size_t i = 0; i < k; ++i) {
+        // Dynamic ends per constraint (kNoColor for a static / kinematic end), packed so the
+        // rounds below stay out of the Constraint records.
+        conEnds_.resize(k);
+        bodyConStart_.assign(nb + 1, 0);
+        for (uint32_t i = 0; i < k; ++i) {
             const Constraint& c = constraints_[i];
-            uint64_t forbidden = 0;
-            if (bodies_[c.a].invMass != Real(0)) forbidden |= bodyColorMask_[c.a];
-            if (bodies_[c.b].invMass != Real(0)) forbidden |= bodyColorMask_[c.b];
-            uint32_t color = 0;
-            while (color < 63 && (forbidden & (1ull << color))) ++color;   // lowest free color
-            constraintColor_[i] = color;
-            const uint64_t bit = 1ull << color;
-            if (bodies_[c.a].invMass != Real(0)) bodyColorMask_[c.a] |= bit;
-            if (bodies_[c.b].invMass != Real(0)) bodyColorMask_[c.b] |= bit;
-            numColors_ = std::max(numColors_, color + 1);
+            conEnds_[i] = { invMass_[c.a] != Real(0) ? c.a : kNoColor, invMass_[c.b] != Real(0) ? c.b : kNoColor };
+            for (const uint32_t body : conEnds_[i])
+                if (body != kNoColor) ++bodyConStart_[body + 1];
+        }
+
+        // Hubs → tail; the rest go into per-body lists.
+        auto hub = [&](uint32_t body) { return body != kNoColor && bodyConStart_[body + 1] >= kHubDegree; };
+        constraintColor_.assign(k, kNoColor);
+        bool anyTail = false;
+        for (uint32_t i = 0; i < k; ++i)
+            if (hub(conEnds_[i][0]) || hub(conEnds_[i][1])) { constraintColor_[i] = kHubMark; anyTail = true; }
+        if (anyTail) {
+            std::fill(bodyConStart_.begin(), bodyConStart_.end(), 0u);
+            for (uint32_t i = 0; i < k; ++i)
+                if (constraintColor_[i] != kHubMark)
+                    for (const uint32_t body : conEnds_[i])
+                        if (body != kNoColor) ++bodyConStart_[body + 1];
+        }
+        for (uint32_t b = 0; b < nb; ++b) bodyConStart_[b + 1] += bodyConStart_[b];
+        bodyCons_.resize(bodyConStart_[nb]);
+        bodyHead_.assign(bodyConStart_.begin(), bodyConStart_.end() - 1);
+        for (uint32_t i = 0; i < k; ++i)
+            if (constraintColor_[i] != kHubMark)
+                for (const uint32_t body : conEnds_[i])
+                    if (body != kNoColor) bodyCons_[bodyHead_[body]++] = i;
+        forAll(nb, [&](size_t b) {   // short lists (< kHubDegree): insertion sort, highest first
+            uint32_t* list = bodyCons_.data() + bodyConStart_[b];
+            const uint32_t n = bodyConStart_[b + 1] - bodyConStart_[b];
+            for (uint32_t x = 1; x < n; ++x) {
+                const uint32_t v = list[x];
+                const uint32_t pv = colorPriority(v);
+                uint32_t y = x;
+                for (; y > 0; --y) {
+                    const uint32_t pu = colorPriority(list[y - 1]);
+                    if (pu > pv || (pu == pv && list[y - 1] < v)) break;
+                    list[y] = list[y - 1];
+                }
+                list[y] = v;
+            }
+        });
+        bodyHead_.assign(bodyConStart_.begin(), bodyConStart_.end() - 1);
+        bodyColorMask_.assign(nb, ColorMask{});
+        bodyRound_.assign(nb, 0);
+
+        frontier_.clear();
+        for (uint32_t i = 0; i < k; ++i)
+            if (constraintColor_[i] != kHubMark && colorReady(i)) frontier_.push_back(i);
+
+        // Rounds: color the frontier and advance its bodies' heads, then (after the join) collect
+        // heads that became ready. A new head touching two advanced bodies is queued once, from
+        // the lower one. Colors depend only on the round structure, not on frontier order, so the
+        // per-chunk queues are concatenated as they come.
+        const size_t chunks = par ? 4 * (pool_->workerCount() + 1) : 1;
+        released_.resize(chunks);
+        for (uint32_t round = 1; !frontier_.empty(); ++round) {
+            forAll(frontier_.size(), [&](size_t t) {
+                const uint32_t i = frontier_[t];
+                const uint32_t col = lowestFree(usedColors(i));
+                constraintColor_[i] = col;
+                for (const uint32_t body : conEnds_[i])
+                    if (body != kNoColor) {
+                        flip(bodyColorMask_[body], col);
+                        ++bodyHead_[body];
+                        bodyRound_[body] = round;
+                    }
+            });
+            const size_t per = (frontier_.size() + chunks - 1) / chunks;
+            forAll(chunks, [&](size_t ch) {
+                std::vector<uint32_t>& out = released_[ch];
+                out.clear();
+                const size_t end = std::min(frontier_.size(), (ch + 1) * per);
+                for (size_t t = ch * per; t < end; ++t) {
+                    for (const uint32_t body : conEnds_[frontier_[t]]) {
+                        if (body == kNoColor) continue;
+                        const uint32_t j = headOf(body);
+                        if (j == kNoColor || !colorReady(j)) continue;
+                        const uint32_t other = conEnds_[j][0] == body ? conEnds_[j][1] : conEnds_[j][0];
+                        if (other != kNoColor && bodyRound_[other] == round && other < body) continue;
+                        out.push_back(j);
+                    }
+                }
+            });
+            frontier_.clear();
+            for (const std::vector<uint32_t>& out : released_) frontier_.insert(frontier_.end(), out.begin(), out.end());
+        }
+
+        numColors_ = 0;
+        for (const uint32_t col : constraintColor_)
+            if (col != kHubMark) numColors_ = std::max(numColors_, col + 1);
+        balanceColors(k);
+
+        tailColor_ = kNoColor;
+        if (anyTail) {
+            tailColor_ = numColors_++;
+            for (uint32_t& col : constraintColor_)
+                if (col == kHubMark) col = tailColor_;
         }
 
         // Counting-sort constraint indices into contiguous per-color runs.
@@ -563,257 +843,1062 @@ private:
         for (size_t i = 0; i < k; ++i) ordered_[colorCursor_[constraintColor_[i]]++] = static_cast<uint32_t>(i);
     }
 
-    // One Gauss-Seidel sweep: colors sequentially, constraints within a color in parallel
-    // (disjoint dynamic bodies → no write conflicts).
-    void solveColored() {
-        for (uint32_t col = 0; col < numColors_; ++col) {
-            const uint32_t begin = colorStart_[col];
-            const uint32_t end = colorStart_[col + 1];
-            const uint32_t count = end - begin;
-            auto solveOne = [&](size_t t) { solveConstraint(constraints_[ordered_[begin + t]]); };
-            if (pool_ && count >= threshold_) pool_->parallelFor(count, solveOne, 64);
-            else for (uint32_t t = 0; t < count; ++t) solveOne(t);
+    // One serial pass in index order, on the body masks the rounds left behind: a constraint in a
+    // color above the mean moves to the smallest below-mean color free on its bodies. Its old
+    // color is then free on those bodies again (one color never repeats on a body).
+    void balanceColors(uint32_t k) {
+        if (numColors_ < 2) return;
+        colorSize_.assign(numColors_, 0);
+        uint32_t total = 0;
+        for (const uint32_t col : constraintColor_)
+            if (col != kHubMark) { ++colorSize_[col]; ++total; }
+        const uint32_t mean = (total + numColors_ - 1) / numColors_;
+        for (uint32_t i = 0; i < k; ++i) {
+            const uint32_t src = constraintColor_[i];
+            if (src == kHubMark || colorSize_[src] <= mean) continue;
+            const ColorMask used = usedColors(i);
+            uint32_t dst = kNoColor;
+            for (uint32_t col = 0; col < numColors_; ++col)
+                if (colorSize_[col] < mean && !holds(used, col) && (dst == kNoColor || colorSize_[col] < colorSize_[dst]))
+                    dst = col;
+            if (dst == kNoColor) continue;
+            constraintColor_[i] = dst;
+            --colorSize_[src];
+            ++colorSize_[dst];
+            for (const uint32_t body : conEnds_[i])
+                if (body != kNoColor) { flip(bodyColorMask_[body], src); flip(bodyColorMask_[body], dst); }
+        }
+    }
+
+    // ---- Sleeping (WorldDef::allowSleep) ----
+    // A body rests while its speeds stay under the SolverConfig thresholds; an island whose bodies
+    // have all rested for solver.sleepTime goes to sleep as one sleep set. Sleepers read as static
+    // (invMass 0, not moving): no gravity, integration, narrowphase or solve. Their last contacts
+    // stay cached (warm-start entries are not pruned; contact events are re-reported each step).
+    // A set wakes when an awake body/moving kinematic overlaps it in the broadphase, when a joint
+    // on it changes, or on setBodyState/destroyBody of a member or a body it rests on.
+    static constexpr uint32_t kNoSleepSet = ~0u;
+
+    bool asleep(uint32_t i) const { return i < sleepSet_.size() && sleepSet_[i] != kNoSleepSet; }
+
+    // Awake and able to push a sleeper: an awake dynamic body or a kinematic body with velocity.
+    bool wakes(uint32_t i) const {
+        if (invMass_[i] != Real(0)) return true;
+        return bodies_[i].type == BodyType::Kinematic && bodies_[i].alive
+            && (linVel_[i] != Vec3(0) || angVel_[i] != Vec3(0));
+    }
+
+    void wakeSet(uint32_t s) {
+        for (uint32_t i : sleepSets_[s]) {
+            sleepSet_[i] = kNoSleepSet;
+            sleepTimer_[i] = 0;
+            invMass_[i] = bodies_[i].invMass;
+            moving_[i] = 1;
+            if (i < worldInvInertia_.size())   // mid-substep wake: the solve reads this substep's cache
+                worldInvInertia_[i] = worldInvInertia(orientation_[i], invInertiaLocal_[i]);
+        }
+        numSleeping_ -= static_cast<uint32_t>(sleepSets_[s].size());
+        sleepSets_[s].clear();
+        sleepSetFree_.push_back(s);
+        sleepEventsStale_ = true;
+    }
+    void wakeBody(uint32_t i) { if (asleep(i)) wakeSet(sleepSet_[i]); }
+    void wakeJoint(const JointData& j) { wakeBody(j.a); wakeBody(j.b); }
+    void wakeAll() {
+        for (uint32_t s = 0; s < sleepSets_.size(); ++s)
+            if (!sleepSets_[s].empty()) wakeSet(s);
+    }
+    // Wakes body i and every sleeper that rests on it (found through the cached sleeping contacts).
+    void wakeTouching(uint32_t i) {
+        if (numSleeping_ == 0) return;
+        wakeBody(i);
+        for (size_t e = 0; e < sleepEvents_.size(); ++e) {
+            const ContactEvent& ev = sleepEvents_[e];
+            if (ev.a.index == i) wakeBody(ev.b.index);
+            else if (ev.b.index == i) wakeBody(ev.a.index);
         }
     }
 
-    SupportShape supportOf(const BodyData& b) const {
+    // Broadphase-time wake: sleepers overlapping an awake mover wake before candidate filtering,
+    // so their island is solved this substep. Decided on the state before any wake (no cascade).
+    void wakeTouched() {
+        wakeList_.clear();
+        for (const auto& [pa, pb] : pairs_) {
+            const uint32_t i = finiteIdx_[pa];
+            const uint32_t j = finiteIdx_[pb];
+            if (asleep(i) && wakes(j)) wakeList_.push_back(sleepSet_[i]);
+            else if (asleep(j) && wakes(i)) wakeList_.push_back(sleepSet_[j]);
+        }
+        for (uint32_t p : planeIdx_) {
+            if (!wakes(p)) continue;
+            for (uint32_t f : finiteIdx_) if (asleep(f)) wakeList_.push_back(sleepSet_[f]);
+        }
+        for (uint32_t s : wakeList_)
+            if (!sleepSets_[s].empty()) wakeSet(s);
+    }
+
+    // End of step: advance rest timers, put fully-rested islands (from the last substep) to sleep,
+    // and re-report the sleepers' cached contacts.
+    void updateSleep(Real dt) {
+        if (sleepEventsStale_) {   // drop events of sets woken since they were cached
+            std::erase_if(sleepEvents_, [&](const ContactEvent& e) {
+                return !asleep(e.a.index) && !asleep(e.b.index);
+            });
+            sleepEventsStale_ = false;
+        }
+        const size_t fresh = events_.size();   // events_ past this: re-reported sleeper contacts
+        if (def_.contactEvents) events_.insert(events_.end(), sleepEvents_.begin(), sleepEvents_.end());
+
+        const Real lin2 = def_.solver.sleepLinearVelocity * def_.solver.sleepLinearVelocity;
+        const Real ang2 = def_.solver.sleepAngularVelocity * def_.solver.sleepAngularVelocity;
+        forEachDynamic([&](size_t i) {
+            const bool resting = glm::dot(linVel_[i], linVel_[i]) <= lin2 && glm::dot(angVel_[i], angVel_[i]) <= ang2;
+            sleepTimer_[i] = resting ? sleepTimer_[i] + dt : Real(0);
+        });
+
+        // An island touching a moving kinematic body must stay awake; so must one whose members
+        // were created/woken after the islands were built (no island id yet).
+        islandRest_.assign(numIslands_, def_.solver.sleepTime);
+        for (uint32_t i = 0; i < invMass_.size(); ++i) {
+            if (invMass_[i] == Real(0)) continue;
+            const uint32_t k = i < islandOf_.size() ? islandOf_[i] : kNoIsland;
+            if (k == kNoIsland) continue;
+            islandRest_[k] = std::min(islandRest_[k], sleepTimer_[i]);
+        }
+        for (const Constraint& c : constraints_) {   // the last substep's contacts
+            if (wakes(c.a) && invMass_[c.a] == Real(0) && invMass_[c.b] != Real(0))
+                islandRest_[islandOf_[c.b]] = 0;   // a is a moving kinematic
+            if (wakes(c.b) && invMass_[c.b] == Real(0) && invMass_[c.a] != Real(0))
+                islandRest_[islandOf_[c.a]] = 0;
+        }
+        for (const JointData& j : joints_) {
+            if (!j.alive) continue;
+            if (invMass_[j.a] == Real(0) && wakes(j.a) && invMass_[j.b] != Real(0)) islandRest_[islandOf_[j.b]] = 0;
+            if (invMass_[j.b] == Real(0) && wakes(j.b) && invMass_[j.a] != Real(0)) islandRest_[islandOf_[j.a]] = 0;
+        }
+
+        islandSleepSet_.assign(numIslands_, kNoSleepSet);
+        bool fellAsleep = false;
+        for (uint32_t i = 0; i < invMass_.size(); ++i) {
+            if (invMass_[i] == Real(0)) continue;
+            const uint32_t k = i < islandOf_.size() ? islandOf_[i] : kNoIsland;
+            if (k == kNoIsland || islandRest_[k] < def_.solver.sleepTime) continue;
+            if (islandSleepSet_[k] == kNoSleepSet) {
+                uint32_t s;
+                if (!sleepSetFree_.empty()) { s = sleepSetFree_.back(); sleepSetFree_.pop_back(); }
+                else { s = static_cast<uint32_t>(sleepSets_.size()); sleepSets_.emplace_back(); }
+                islandSleepSet_[k] = s;
+            }
+            sleepSets_[islandSleepSet_[k]].push_back(i);
+            sleepSet_[i] = islandSleepSet_[k];
+            invMass_[i] = Real(0);
+            moving_[i] = 0;
+            linVel_[i] = Vec3(0);
+            angVel_[i] = Vec3(0);
+            ++numSleeping_;
+            fellAsleep = true;
+        }
+        if (!fellAsleep) return;
+        // Cache the new sleepers' contacts from the last substep (older sleepers are already cached).
+        // They are also what wakeTouching() follows, so without reported events they are rebuilt
+        // from the constraints.
+        auto cache = [&](const ContactEvent& e) {
+            if ((asleep(e.a.index) || asleep(e.b.index)) && !wakes(e.a.index) && !wakes(e.b.index))
+                sleepEvents_.push_back(e);
+        };
+        if (def_.contactEvents)
+            for (size_t c = substepEventBegin_; c < fresh; ++c) cache(events_[c]);
+        else
+            for (const Constraint& c : constraints_)
+                cache(ContactEvent{ BodyHandle{ c.a, generation_[c.a] }, BodyHandle{ c.b, generation_[c.b] },
+                                    c.point, c.normal, -c.penetration });
+    }
+
+    // ---- Islands ----
+    // Bodies connected through contacts or joints (dynamic ends only — static/kinematic bodies are
+    // never written, so they don't link islands) form an island. Islands share no dynamic body, so
+    // each one's whole velocity/position solve is an independent task. Constraints are kept in
+    // island-major, color-minor order (the global color order restricted to the island), split into
+    // runs of one color; joints likewise, by joint color (colorJoints). Big islands are solved one
+    // at a time with their colors spread over the pool; the rest are batched into pool tasks.
+    static constexpr uint32_t kNoIsland = ~0u;
+    static constexpr uint32_t kJointCost = 4;           // one joint solve ≈ 4 contact solves
+    static constexpr uint32_t kIslandBatchCost = 256;   // contacts + kJointCost·joints per pool task
+
+    uint32_t findRoot(uint32_t i) {
+        while (ufParent_[i] != i) { ufParent_[i] = ufParent_[ufParent_[i]]; i = ufParent_[i]; }
+        return i;
+    }
+    void unite(uint32_t a, uint32_t b) {
+        a = findRoot(a); b = findRoot(b);
+        if (a < b) ufParent_[b] = a; else if (b < a) ufParent_[a] = b;   // lowest slot is the root
+    }
+    // Island of a constraint/joint: that of its dynamic end (at least one is dynamic).
+    uint32_t islandOfPair(uint32_t a, uint32_t b) const {
+        return islandOf_[invMass_[a] != Real(0) ? a : b];
+    }
+    bool jointActive(const JointData& j) const {
+        return j.alive && (invMass_[j.a] != Real(0) || invMass_[j.b] != Real(0));
+    }
+
+    void buildIslands() {
+        colorJoints();
+        const uint32_t nb = static_cast<uint32_t>(bodies_.size());
+        ufParent_.resize(nb);
+        for (uint32_t i = 0; i < nb; ++i) ufParent_[i] = i;
+        for (const Constraint& c : constraints_)
+            if (invMass_[c.a] != Real(0) && invMass_[c.b] != Real(0)) unite(c.a, c.b);
+        for (const JointData& j : joints_)
+            if (j.alive && invMass_[j.a] != Real(0) && invMass_[j.b] != Real(0)) unite(j.a, j.b);
+
+        // Number islands in body order (a root is its set's lowest slot, so it is seen first).
+        islandOf_.assign(nb, kNoIsland);
+        numIslands_ = 0;
+        for (uint32_t i = 0; i < nb; ++i) {
+            if (invMass_[i] == Real(0)) continue;
+            const uint32_t r = findRoot(i);
+            islandOf_[i] = (r == i) ? numIslands_++ : islandOf_[r];
+        }
+
+        // Constraints: stable counting sort of the color-ordered list by island.
+        islandConStart_.assign(numIslands_ + 1, 0);
+        for (const Constraint& c : constraints_) ++islandConStart_[islandOfPair(c.a, c.b) + 1];
+        for (uint32_t k = 0; k < numIslands_; ++k) islandConStart_[k + 1] += islandConStart_[k];
+        islandCons_.resize(constraints_.size());
+        islandCursor_.assign(islandConStart_.begin(), islandConStart_.end() - 1);
+        for (uint32_t ci : ordered_) {
+            const Constraint& c = constraints_[ci];
+            islandCons_[islandCursor_[islandOfPair(c.a, c.b)]++] = ci;
+        }
+
+        // Joints: stable counting sort of the color-ordered list by island, then runs of one color.
+        islandJointStart_.assign(numIslands_ + 1, 0);
+        for (const uint32_t ji : jointOrdered_) ++islandJointStart_[islandOfPair(joints_[ji].a, joints_[ji].b) + 1];
+        for (uint32_t k = 0; k < numIslands_; ++k) islandJointStart_[k + 1] += islandJointStart_[k];
+        islandJoints_.resize(islandJointStart_[numIslands_]);
+        islandCursor_.assign(islandJointStart_.begin(), islandJointStart_.end() - 1);
+        for (const uint32_t ji : jointOrdered_) islandJoints_[islandCursor_[islandOfPair(joints_[ji].a, joints_[ji].b)]++] = ji;
+        jointRunStart_.clear(); jointRunColor_.clear();
+        islandJointRunStart_.assign(numIslands_ + 1, 0);
+        for (uint32_t k = 0; k < numIslands_; ++k) {
+            for (uint32_t t = islandJointStart_[k]; t < islandJointStart_[k + 1]; ++t) {
+                const uint32_t col = jointColor_[islandJoints_[t]];
+                if (t == islandJointStart_[k] || col != jointRunColor_.back()) { jointRunStart_.push_back(t); jointRunColor_.push_back(col); }
+            }
+            islandJointRunStart_[k + 1] = static_cast<uint32_t>(jointRunColor_.size());
+        }
+        jointRunStart_.push_back(static_cast<uint32_t>(islandJoints_.size()));
+        buildJointTrees();
+
+        // Color runs (flattened across islands; islands are contiguous in islandCons_) and the
+        // wide-solver blocks of each run.
+        runStart_.clear(); runColor_.clear();
+        islandRunStart_.assign(numIslands_ + 1, 0);
+        for (uint32_t k = 0; k < numIslands_; ++k) {
+            for (uint32_t t = islandConStart_[k]; t < islandConStart_[k + 1]; ++t) {
+                const uint32_t col = constraintColor_[islandCons_[t]];
+                if (t == islandConStart_[k] || col != runColor_.back()) { runStart_.push_back(t); runColor_.push_back(col); }
+            }
+            islandRunStart_[k + 1] = static_cast<uint32_t>(runColor_.size());
+        }
+        runStart_.push_back(static_cast<uint32_t>(islandCons_.size()));
+        const size_t numRuns = runColor_.size();
+        runBlockStart_.assign(numRuns + 1, 0);
+        for (size_t r = 0; r < numRuns; ++r) {
+            const uint32_t count = runStart_[r + 1] - runStart_[r];
+            runBlockStart_[r + 1] = runBlockStart_[r] + (runColor_[r] != tailColor_ ? (count + kLanes - 1) / kLanes : 0);
+        }
+        if (def_.wideContactSolver) blocks_.resize(runBlockStart_[numRuns]);
+
+        // Schedule: big islands alone (parallel inside), the rest batched by cost.
+        largeIslands_.clear(); batchIslands_.clear();
+        islandIters_.assign(numIslands_, 0);
+        islandResidual_.assign(numIslands_, Real(0));
+        batchStart_.assign(1, 0);
+        batchedWork_ = 0;
+        uint32_t cost = 0;
+        for (uint32_t k = 0; k < numIslands_; ++k) {
+            const uint32_t cons = islandConStart_[k + 1] - islandConStart_[k];
+            const uint32_t joints = islandJointStart_[k + 1] - islandJointStart_[k];
+            if (cons + joints == 0) continue;
+            if (pool_ && cons + kJointCost * joints >= threshold_) { largeIslands_.push_back(k); continue; }
+            batchIslands_.push_back(k);
+            batchedWork_ += cons + joints;
+            cost += cons + kJointCost * joints;
+            if (cost >= kIslandBatchCost) { batchStart_.push_back(static_cast<uint32_t>(batchIslands_.size())); cost = 0; }
+        }
+        if (batchStart_.back() != batchIslands_.size()) batchStart_.push_back(static_cast<uint32_t>(batchIslands_.size()));
+    }
+
+    // Runs f(island, parallelInside) over every island with work. Large islands go one at a time
+    // from the calling thread (f may use the pool inside); batches of small islands are pool tasks
+    // (f must stay serial — the pool doesn't nest).
+    template <class F>
+    void forEachIsland(F&& f) {
+        for (uint32_t k : largeIslands_) f(k, true);
+        const size_t nb = batchStart_.size() - 1;
+        auto batch = [&](size_t t) {
+            for (uint32_t i = batchStart_[t]; i < batchStart_[t + 1]; ++i) f(batchIslands_[i], false);
+        };
+        if (pool_ && nb > 1 && batchedWork_ >= threshold_) pool_->parallelFor(nb, batch, 1);
+        else for (size_t t = 0; t < nb; ++t) batch(t);
+    }
+
+    // f(constraint index) over one color run; in parallel when allowed and the run is big (never
+    // for the serial tail color).
+    template <class F>
+    void forEachInRun(uint32_t r, bool par, F&& f) {
+        const uint32_t begin = runStart_[r];
+        const uint32_t count = runStart_[r + 1] - begin;
+        auto one = [&](size_t t) { f(islandCons_[begin + t]); };
+        if (par && count >= threshold_ && runColor_[r] != tailColor_) pool_->parallelFor(count, one, 64);
+        else for (uint32_t t = 0; t < count; ++t) one(t);
+    }
+
+    // Largest f(t) over t in [0, count) (f ≥ 0), in pool chunks of `grain` when par. Max is exact
+    // and order-free, so the result does not depend on how the range was split.
+    template <class F>
+    Real maxOver(uint32_t count, bool par, uint32_t grain, F&& f) {
+        if (!par) {
+            Real m = 0;
+            for (uint32_t t = 0; t < count; ++t) m = std::max(m, f(t));
+            return m;
+        }
+        std::atomic<Real> res{ Real(0) };
+        pool_->parallelFor((count + grain - 1) / grain, [&](size_t c) {
+            Real m = 0;
+            const uint32_t end = std::min<uint32_t>(count, static_cast<uint32_t>(c + 1) * grain);
+            for (uint32_t t = static_cast<uint32_t>(c) * grain; t < end; ++t) m = std::max(m, f(t));
+            Real cur = res.load(std::memory_order_relaxed);
+            while (m > cur && !res.compare_exchange_weak(cur, m, std::memory_order_relaxed)) {}
+        }, 1);
+        return res.load(std::memory_order_relaxed);
+    }
+
+    // Velocity solve of one island: warm start, then sweeps of {joint trees, joints, contacts} —
+    // `velocityIterations` of them, or with solver.velocityTolerance set, until a sweep's residual
+    // (largest accumulated-impulse change) drops to the tolerance, capped at maxVelocityIterations.
+    void solveIslandVelocity(uint32_t k, bool par) {
+        const uint32_t r0 = islandRunStart_[k], r1 = islandRunStart_[k + 1];
+        for (uint32_t r = r0; r < r1; ++r) warmStartRun(r, par);   // seed from the prior solution
+        const bool wide = def_.wideContactSolver;
+        if (wide) for (uint32_t r = r0; r < r1; ++r) packRun(r, par);
+        const bool tree = factorJointTree(k);
+        const Real tol = def_.solver.velocityTolerance;
+        const int  maxIt = tol > Real(0) ? def_.solver.maxVelocityIterations : def_.velocityIterations;
+        int  it = 0;
+        Real residual = 0;
+        while (it < maxIt) {
+            residual = tree ? solveJointTree(k) : Real(0);
+            for (uint32_t r = islandJointRunStart_[k]; r < islandJointRunStart_[k + 1]; ++r)
+                residual = std::max(residual, solveJointRange(jointRunStart_[r], jointRunStart_[r + 1],
+                                                              jointRunColor_[r], islandJoints_, par));
+            for (uint32_t r = r0; r < r1; ++r) residual = std::max(residual, solveRun(r, par));
+            ++it;
+            if (tol > Real(0) && residual <= tol) break;
+        }
+        if (wide) for (uint32_t r = r0; r < r1; ++r) unpackRun(r);
+        islandIters_[k] = it;
+        islandResidual_[k] = residual;
+    }
+
+    // Split-impulse position sweeps of one island (fixed or adaptive, as for the velocity solve):
+    // joint drift first, then contact penetration, in the velocity solve's order.
+    void solveIslandPosition(uint32_t k, bool par) {
+        const Real tol = def_.solver.positionTolerance;
+        const int  maxIt = tol > Real(0) ? def_.solver.maxPositionIterations : def_.positionIterations;
+        int  it = 0;
+        Real residual = 0;
+        while (it < maxIt) {
+            residual = 0;
+            for (uint32_t r = islandJointRunStart_[k]; r < islandJointRunStart_[k + 1]; ++r)
+                residual = std::max(residual, positionJointRange(jointRunStart_[r], jointRunStart_[r + 1],
+                                                                 jointRunColor_[r], islandJoints_, par));
+            for (uint32_t r = islandRunStart_[k]; r < islandRunStart_[k + 1]; ++r)
+                residual = std::max(residual, sweepRun(r, par, [&](uint32_t ci) {
+                    return solvePositionConstraint(constraints_[ci]);
+                }));
+            ++it;
+            if (tol > Real(0) && residual <= tol) break;
+        }
+        islandIters_[k] = it;
+        islandResidual_[k] = residual;
+    }
+
+    // Folds the sweep counts and residuals of the last forEachIsland pass into the step stats.
+    void gatherIslandStats(int& iterations, long& sweeps, Real& residual) const {
+        auto fold = [&](uint32_t k) {
+            iterations = std::max(iterations, islandIters_[k]);
+            sweeps += islandIters_[k];
+            residual = std::max(residual, islandResidual_[k]);
+        };
+        for (uint32_t k : largeIslands_) fold(k);
+        for (uint32_t k : batchIslands_) fold(k);
+    }
+
+    // Largest f(constraint index) over one color run; parallel under forEachInRun's rule.
+    template <class F>
+    Real sweepRun(uint32_t r, bool par, F&& f) {
+        const uint32_t begin = runStart_[r];
+        const uint32_t count = runStart_[r + 1] - begin;
+        return maxOver(count, par && count >= threshold_ && runColor_[r] != tailColor_, 64,
+                       [&](uint32_t t) { return f(islandCons_[begin + t]); });
+    }
+
+    // One Gauss-Seidel pass over a color run (disjoint dynamic bodies → parallel-safe), returning
+    // its residual. With the wide solver on, the run is solved as packed SIMD blocks instead of one
+    // by one.
+    Real solveRun(uint32_t r, bool par) {
+        if (def_.wideContactSolver && runColor_[r] != tailColor_) {
+            const uint32_t b0 = runBlockStart_[r];
+            const uint32_t nb = runBlockStart_[r + 1] - b0;
+            return maxOver(nb, par && runStart_[r + 1] - runStart_[r] >= threshold_, 64 / kLanes,
+                           [&](uint32_t t) { return solveContactBlock(blocks_[b0 + t]); });
+        }
+        return sweepRun(r, par, [&](uint32_t ci) { return solveConstraint(constraints_[ci]); });
+    }
+
+    // ---- Wide contact solve (WorldDef::wideContactSolver) ----
+    // Each color run's constraints are packed, in solve order, into blocks of simd::kWidth lanes
+    // holding everything the velocity iterations read except the body velocities, which are
+    // gathered/scattered per block per sweep. Lanes mirror solveConstraint operation for
+    // operation. Padding lanes past a run's end have zero mass and normal → zero impulse, and
+    // are never scattered. The serial tail color holds conflicting constraints, so it stays on the
+    // scalar path.
+    static constexpr int      kLanes = simd::kWidth;
+
+    struct alignas(32) ContactBlock {
+        uint32_t a[kLanes], b[kLanes];
+        uint32_t constraint[kLanes];                // index into constraints_ (write-back)
+        float    rA[3][kLanes], rB[3][kLanes], n[3][kLanes];
+        float    imA[kLanes], imB[kLanes];
+        float    IA[9][kLanes], IB[9][kLanes];      // world inverse inertia, column-major m[c][r]
+        float    target[kLanes], kn[kLanes], friction[kLanes];
+        float    nImp[kLanes], tImp[3][kLanes];      // accumulated over the substep's iterations
+        uint32_t count;                             // live lanes
+    };
+
+    // Target normal velocity of a contact for this substep (see solveConstraint).
+    Real contactTarget(const Constraint& c) const {
+        if (c.penetration < Real(0)) {
+            const Real speculative = c.penetration / kSubDt_;   // = -gap/h (negative)
+            return (c.restitutionBias > Real(0)) ? c.restitutionBias : speculative;
+        }
+        if (def_.splitImpulse) return c.restitutionBias;   // penetration handled in the position pass
+        // Legacy Baumgarte: fold the softened, clamped push-out into the real velocity.
+        const Real baumgarte = std::min(
+            (def_.solver.contactBaumgarte / kSubDt_) * std::max(c.penetration - def_.solver.contactSlop, Real(0)),
+            def_.solver.maxCorrection);
+        return baumgarte + c.restitutionBias;
+    }
+
+    void packRun(uint32_t r, bool par) {
+        const uint32_t b0 = runBlockStart_[r];
+        const uint32_t nb = runBlockStart_[r + 1] - b0;
+        const uint32_t end = runStart_[r + 1];
+        auto packBlock = [&](size_t blk) {
+            ContactBlock& k = blocks_[b0 + blk];
+            k = ContactBlock{};
+            const uint32_t first = runStart_[r] + static_cast<uint32_t>(blk) * kLanes;
+            k.count = std::min<uint32_t>(kLanes, end - first);
+            for (uint32_t l = 0; l < uint32_t(kLanes); ++l) {
+                if (l >= k.count) { k.a[l] = k.a[0]; k.b[l] = k.b[0]; continue; }   // padding
+                const uint32_t ci = islandCons_[first + l];
+                const Constraint& c = constraints_[ci];
+                const Vec3 rA = c.point - position_[c.a];
+                const Vec3 rB = c.point - position_[c.b];
+                const Mat3& IA = worldInvInertia_[c.a];
+                const Mat3& IB = worldInvInertia_[c.b];
+                k.a[l] = c.a; k.b[l] = c.b; k.constraint[l] = ci;
+                for (int d = 0; d < 3; ++d) { k.rA[d][l] = rA[d]; k.rB[d][l] = rB[d]; k.n[d][l] = c.normal[d]; }
+                k.imA[l] = invMass_[c.a];
+                k.imB[l] = invMass_[c.b];
+                for (int cc = 0; cc < 3; ++cc)
+                    for (int rr = 0; rr < 3; ++rr) { k.IA[cc * 3 + rr][l] = IA[cc][rr]; k.IB[cc * 3 + rr][l] = IB[cc][rr]; }
+                k.target[l] = contactTarget(c);
+                k.kn[l] = effectiveMass(c.a, c.b, IA, IB, rA, rB, c.normal);
+                k.friction[l] = c.friction;
+                k.nImp[l] = c.normalImpulse;
+                for (int d = 0; d < 3; ++d) k.tImp[d][l] = c.tangentImpulse[d];
+            }
+        };
+        if (par && end - runStart_[r] >= threshold_) pool_->parallelFor(nb, packBlock, 64 / kLanes);
+        else for (uint32_t t = 0; t < nb; ++t) packBlock(t);
+    }
+
+    void unpackRun(uint32_t r) {
+        for (uint32_t t = runBlockStart_[r]; t < runBlockStart_[r + 1]; ++t) {
+            const ContactBlock& k = blocks_[t];
+            for (uint32_t l = 0; l < k.count; ++l) {
+                Constraint& c = constraints_[k.constraint[l]];
+                c.normalImpulse = k.nImp[l];
+                c.tangentImpulse = Vec3(k.tImp[0][l], k.tImp[1][l], k.tImp[2][l]);
+            }
+        }
+    }
+
+    // solveConstraint over kLanes constraints at once (normal, then friction along the current
+    // sliding direction), gathering and scattering the two bodies' velocities per lane. Returns the
+    // largest impulse change over the live lanes.
+    Real solveContactBlock(ContactBlock& k) {
+        using simd::Lanes; using simd::Vec3L; using simd::Mat3L; using simd::Mask;
+        alignas(32) float g[12][kLanes];
+        alignas(32) float dN[kLanes], dT[kLanes];   // per-lane impulse changes (residual)
+        for (int l = 0; l < kLanes; ++l) {
+            const Vec3& va = linVel_[k.a[l]]; const Vec3& wa = angVel_[k.a[l]];
+            const Vec3& vb = linVel_[k.b[l]]; const Vec3& wb = angVel_[k.b[l]];
+            for (int d = 0; d < 3; ++d) {
+                g[d][l] = va[d]; g[3 + d][l] = wa[d]; g[6 + d][l] = vb[d]; g[9 + d][l] = wb[d];
+            }
+        }
+        auto load3 = [](const float (*p)[kLanes]) {
+            return Vec3L{ Lanes::load(p[0]), Lanes::load(p[1]), Lanes::load(p[2]) };
+        };
+        auto loadM = [](const float (*p)[kLanes]) {
+            Mat3L m;
+            for (int cc = 0; cc < 3; ++cc)
+                for (int r = 0; r < 3; ++r) m.m[cc][r] = Lanes::load(p[cc * 3 + r]);
+            return m;
+        };
+        Vec3L vA = load3(g), wA = load3(g + 3), vB = load3(g + 6), wB = load3(g + 9);
+        const Vec3L rA = load3(k.rA), rB = load3(k.rB), n = load3(k.n);
+        const Mat3L IA = loadM(k.IA), IB = loadM(k.IB);
+        const Lanes imA = Lanes::load(k.imA), imB = Lanes::load(k.imB);
+        const Lanes zero = Lanes::splat(0), eps = Lanes::splat(kEpsilon);
+        const Mask  dynA = imA != zero, dynB = imB != zero;
+
+        auto apply = [&](const Vec3L& P, Mask mA, Mask mB) {
+            vA = simd::select(mA, vA - imA * P, vA);
+            wA = simd::select(mA, wA - IA * simd::cross(rA, P), wA);
+            vB = simd::select(mB, vB + imB * P, vB);
+            wB = simd::select(mB, wB + IB * simd::cross(rB, P), wB);
+        };
+        auto relVel = [&] { return (vB + simd::cross(wB, rB)) - (vA + simd::cross(wA, rA)); };
+        auto effMass = [&](const Vec3L& d) {
+            const Vec3L rnA = simd::cross(rA, d), rnB = simd::cross(rB, d);
+            return imA + imB + simd::dot(d, simd::cross(IA * rnA, rA)) + simd::dot(d, simd::cross(IB * rnB, rB));
+        };
+
+        {   // normal
+            const Vec3L vrel = relVel();
+            const Lanes vn = simd::dot(vrel, n);
+            const Lanes kn = Lanes::load(k.kn);
+            Lanes lambda = simd::select(kn > eps, (Lanes::load(k.target) - vn) / kn, zero);
+            const Lanes old = Lanes::load(k.nImp);
+            const Lanes nImp = simd::max(old + lambda, zero);
+            nImp.store(k.nImp);
+            lambda = nImp - old;
+            lambda.store(dN);
+            apply(lambda * n, dynA, dynB);
+        }
+        {   // friction
+            const Vec3L vrel = relVel();
+            const Vec3L vt = vrel - simd::dot(vrel, n) * n;
+            const Lanes vtLen = simd::sqrt(simd::dot(vt, vt));
+            const Mask  slide = vtLen > eps;
+            const Vec3L t = vt / vtLen;
+            const Lanes kt = effMass(t);
+            Lanes lambdaT = simd::select(kt > eps, -simd::dot(vrel, t) / kt, zero);
+            const Lanes maxF = Lanes::load(k.friction) * Lanes::load(k.nImp);
+            const Vec3L oldT{Lanes::load(k.tImp[0]), Lanes::load(k.tImp[1]), Lanes::load(k.tImp[2])};
+            Vec3L tImp = oldT + lambdaT * t;
+            const Lanes tLen = simd::sqrt(simd::dot(tImp, tImp));
+            tImp = simd::select(maxF < tLen, (maxF / tLen) * tImp, tImp);
+            tImp = simd::select(slide, tImp, oldT);
+            tImp.x.store(k.tImp[0]); tImp.y.store(k.tImp[1]); tImp.z.store(k.tImp[2]);
+            const Vec3L P = tImp - oldT;
+            simd::sqrt(simd::dot(P, P)).store(dT);
+            apply(P, slide & dynA, slide & dynB);
+        }
+
+        vA.x.store(g[0]); vA.y.store(g[1]); vA.z.store(g[2]);
+        wA.x.store(g[3]); wA.y.store(g[4]); wA.z.store(g[5]);
+        vB.x.store(g[6]); vB.y.store(g[7]); vB.z.store(g[8]);
+        wB.x.store(g[9]); wB.y.store(g[10]); wB.z.store(g[11]);
+        Real residual = 0;
+        for (uint32_t l = 0; l < k.count; ++l) {
+            if (k.imA[l] != 0.0f) {
+                linVel_[k.a[l]] = Vec3(g[0][l], g[1][l], g[2][l]);
+                angVel_[k.a[l]] = Vec3(g[3][l], g[4][l], g[5][l]);
+            }
+            if (k.imB[l] != 0.0f) {
+                linVel_[k.b[l]] = Vec3(g[6][l], g[7][l], g[8][l]);
+                angVel_[k.b[l]] = Vec3(g[9][l], g[10][l], g[11][l]);
+            }
+            residual = std::max(residual, std::max(std::abs(dN[l]), std::abs(dT[l])));
+        }
+        return residual;
+    }
+
+    SupportShape supportOf(uint32_t i) const {
         using T = ColliderDesc::Type;
-        switch (b.collider.type) {
-            case T::Box:  return SupportShape::box(b.position, b.orientation, b.collider.box.halfExtents);
+        const ColliderDesc& col = bodies_[i].collider;
+        const Vec3& p = position_[i];
+        const Quat& q = orientation_[i];
+        switch (col.type) {
+            case T::Box:  return SupportShape::box(p, q, col.box.halfExtents);
             case T::ConvexHull:
-                return SupportShape::hull(b.position, b.orientation,
-                                          b.collider.convexHull.vertices.data(),
-                                          static_cast<int>(b.collider.convexHull.vertices.size()));
+                if (!bodies_[i].hull.empty()) return SupportShape::hull(p, q, bodies_[i].hull);
+                return SupportShape::hull(p, q, col.convexHull.vertices.data(),
+                                          static_cast<int>(col.convexHull.vertices.size()));
             case T::Capsule:
-                return SupportShape::capsule(b.position, b.orientation,
-                                             b.collider.capsule.radius, b.collider.capsule.halfHeight);
-            default:      return SupportShape::sphere(b.position, b.collider.sphere.radius);
+                return SupportShape::capsule(p, q, col.capsule.radius, col.capsule.halfHeight);
+            default:      return SupportShape::sphere(p, col.sphere.radius);
         }
     }
 
+    // A cooked polytope collider in place (box: the unit cube scaled by its half-extents); a null
+    // hull when the collider is an uncookable vertex cloud.
+    collide::PolytopeView polytopeOf(uint32_t i) const {
+        const BodyCold& b = bodies_[i];
+        collide::PolytopeView v{};
+        v.center = position_[i];
+        v.orient = orientation_[i];
+        if (b.collider.type == ColliderDesc::Type::Box) {
+            v.hull = &unitBoxHull();
+            v.scale = b.collider.box.halfExtents;
+        } else if (!b.hull.empty()) {
+            v.hull = &b.hull;
+        }
+        return v;
+    }
+
     // World-space vertices of a polytope collider (box: 8 corners; hull: transformed verts).
-    void worldVerts(const BodyData& b, std::vector<Vec3>& out) const {
+    void worldVerts(uint32_t i, std::vector<Vec3>& out) const {
         out.clear();
-        if (b.collider.type == ColliderDesc::Type::Box) {
-            const Vec3 he = b.collider.box.halfExtents;
+        const ColliderDesc& col = bodies_[i].collider;
+        const Vec3& p = position_[i];
+        const Quat& q = orientation_[i];
+        if (col.type == ColliderDesc::Type::Box) {
+            const Vec3 he = col.box.halfExtents;
             for (int sx = -1; sx <= 1; sx += 2)
                 for (int sy = -1; sy <= 1; sy += 2)
                     for (int sz = -1; sz <= 1; sz += 2)
-                        out.push_back(b.position + b.orientation * Vec3(sx * he.x, sy * he.y, sz * he.z));
-        } else if (b.collider.type == ColliderDesc::Type::ConvexHull) {
-            for (const Vec3& v : b.collider.convexHull.vertices)
-                out.push_back(b.position + b.orientation * v);
+                        out.push_back(p + q * Vec3(sx * he.x, sy * he.y, sz * he.z));
+        } else if (col.type == ColliderDesc::Type::ConvexHull) {
+            for (const Vec3& v : col.convexHull.vertices)
+                out.push_back(p + q * v);
         }
     }
 
     // Pure narrowphase: computes a small contact manifold for a body pair into `out`. Plane
     // (half-space) pairs use exact/clip tests; sphere-sphere and sphere-box are exact; all other
     // convex pairs (box-box, hull-hull, box-hull, sphere-hull) go through GJK + EPA.
-    void narrowphase(uint32_t i, uint32_t j, Real h, PairResult& out) const {
+    // `axis` is the pair's GJK separating-axis slot (see axisCache_); out.axisOut marks it written.
+    // capsuleVsConvex runs its own GJK but reports no axis, so only the `convex` path sets it.
+    void narrowphase(uint32_t i, uint32_t j, Real h, PairResult& out, Contact* slots, Vec3& axis) const {
         using T = ColliderDesc::Type;
-        out.count = 0;
-        const BodyData& A = bodies_[i];
-        const BodyData& B = bodies_[j];
-
-        // Speculative margin (CCD): generate contacts up to the distance the pair could close
-        // this substep, so a fast body is stopped at the surface instead of tunnelling.
-        const Real specMargin = def_.continuousDetection
-            ? (glm::length(A.linVel) + glm::length(B.linVel)) * h : Real(0);
-
-        auto add = [&](uint32_t a, uint32_t b, const Contact& c) {
-            if (out.count >= 4) return;
-            Constraint con;
-            con.a = a; con.b = b;
-            con.normal = c.normal;
-            con.point = c.point;
-            con.penetration = -c.separation;
-            const Vec3 vrel = relativeVelocity(con);
-            const Real vn = glm::dot(vrel, con.normal);
-            const Real e = std::min(bodies_[a].material.restitution, bodies_[b].material.restitution);
-            con.restitutionBias = (vn < Real(-1)) ? e * (-vn) : Real(0);
-            // Stable id for warm-starting: (bodyA, bodyB, contact-index-within-pair). Narrowphase is
-            // deterministic, so a resting contact keeps the same key across substeps/steps.
-            con.key = (static_cast<uint64_t>(a) << 40) | (static_cast<uint64_t>(b) << 8)
-                    | static_cast<uint64_t>(out.count & 0xFF);
-            out.c[out.count] = con;
-            out.e[out.count] = ContactEvent{
-                BodyHandle{ a, bodies_[a].generation }, BodyHandle{ b, bodies_[b].generation },
-                con.point, con.normal, c.separation };
-            ++out.count;
-        };
+        out = PairResult{};
+        const BodyCold& A = bodies_[i];
+        const BodyCold& B = bodies_[j];
+        const Vec3& pA = position_[i];
+        const Vec3& pB = position_[j];
+        const Quat& qA = orientation_[i];
+        const Quat& qB = orientation_[j];
+
+        const Real specMargin = speculativeMargin(i, j, h);
+
+        auto add = [&](uint32_t a, uint32_t b, const Contact& c) { stageContact(a, b, c, out, slots); };
 
         // --- half-space plane vs a finite shape (multi-contact for stable resting) ---
         if (A.collider.type == T::Plane || B.collider.type == T::Plane) {
             const uint32_t pi = (A.collider.type == T::Plane) ? i : j;   // plane
             const uint32_t oi = (A.collider.type == T::Plane) ? j : i;   // other
-            const BodyData& P = bodies_[pi];
-            const BodyData& O = bodies_[oi];
+            const BodyCold& P = bodies_[pi];
+            const BodyCold& O = bodies_[oi];
+            const Vec3& pO = position_[oi];
+            const Quat& qO = orientation_[oi];
             Contact cs[4];
             int n = 0;
             if (O.collider.type == T::Sphere) {
-                if (collide::sphereVsPlane(O.position, O.collider.sphere, P.collider.plane, specMargin, cs[0])) n = 1;
+                if (collide::sphereVsPlane(pO, O.collider.sphere, P.collider.plane, specMargin, cs[0])) n = 1;
             } else if (O.collider.type == T::Box) {
-                n = collide::boxVsPlane(O.position, O.orientation, O.collider.box, P.collider.plane, specMargin, cs);
+                n = collide::boxVsPlane(pO, qO, O.collider.box, P.collider.plane, specMargin, cs);
+            } else if (O.collider.type == T::ConvexHull && !O.hull.empty()) {
+                n = collide::hullVsPlane(pO, qO, O.hull, P.collider.plane, specMargin, cs);
             } else if (O.collider.type == T::ConvexHull) {
                 thread_local std::vector<Vec3> wv;
                 wv.clear();
-                for (const Vec3& v : O.collider.convexHull.vertices) wv.push_back(O.position + O.orientation * v);
+                for (const Vec3& v : O.collider.convexHull.vertices) wv.push_back(pO + qO * v);
                 n = collide::pointsVsPlane(wv.data(), static_cast<int>(wv.size()), P.collider.plane, specMargin, cs);
             } else if (O.collider.type == T::Capsule) {
-                n = collide::capsuleVsPlane(O.position, O.orientation, O.collider.capsule, P.collider.plane, specMargin, cs);
+                n = collide::capsuleVsPlane(pO, qO, O.collider.capsule, P.collider.plane, specMargin, cs);
             }
             for (int k = 0; k < n; ++k) add(pi, oi, cs[k]);   // normal plane -> other
             return;
         }
 
         // --- finite vs finite ---
+        auto convex = [&](Contact& hit) {   // GJK, + EPA on overlap (counted for StepStats)
+            const SupportShape sa = supportOf(i), sb = supportOf(j);
+            const auto* cached = axisCache_.find(pairKey(i, j));
+            axis = cached ? cached->value : Vec3(0);
+            out.axisOut = 1;
+            if (gjkSeparated(sa, sb, axis)) { out.axisHit = 1; return false; }
+            ++out.gjk;
+            const bool overlap = collide::convexVsConvex(sa, sb, hit, &axis);
+            out.epa += overlap;
+            return overlap;
+        };
         Contact c;
         if (A.collider.type == T::Sphere && B.collider.type == T::Sphere) {
-            if (collide::sphereVsSphere(A.position, A.collider.sphere, B.position, B.collider.sphere, specMargin, c))
+            if (collide::sphereVsSphere(pA, A.collider.sphere, pB, B.collider.sphere, specMargin, c))
                 add(i, j, c);
         } else if (A.collider.type == T::Sphere && B.collider.type == T::Box) {
-            if (collide::sphereVsBox(B.position, B.orientation, B.collider.box, A.position, A.collider.sphere, specMargin, c))
+            if (collide::sphereVsBox(pB, qB, B.collider.box, pA, A.collider.sphere, specMargin, c))
                 add(j, i, c);   // normal box(j) -> sphere(i)
         } else if (A.collider.type == T::Box && B.collider.type == T::Sphere) {
-            if (collide::sphereVsBox(A.position, A.orientation, A.collider.box, B.position, B.collider.sphere, specMargin, c))
+            if (collide::sphereVsBox(pA, qA, A.collider.box, pB, B.collider.sphere, specMargin, c))
                 add(i, j, c);   // normal box(i) -> sphere(j)
         } else if (A.collider.type == T::Box && B.collider.type == T::Box) {
             Contact cs[4];
-            const int n = collide::boxVsBox(A.position, A.orientation, A.collider.box,
-                                            B.position, B.orientation, B.collider.box, cs);
+            const int n = collide::boxVsBox(pA, qA, A.collider.box,
+                                            pB, qB, B.collider.box, cs);
             for (int k = 0; k < n; ++k) add(i, j, cs[k]);   // normal A -> B
         } else if (A.collider.type == T::Capsule && B.collider.type == T::Sphere) {
-            if (collide::capsuleVsSphere(A.position, A.orientation, A.collider.capsule, B.position, B.collider.sphere, specMargin, c))
+            if (collide::capsuleVsSphere(pA, qA, A.collider.capsule, pB, B.collider.sphere, specMargin, c))
                 add(i, j, c);   // capsule(i) -> sphere(j)
         } else if (A.collider.type == T::Sphere && B.collider.type == T::Capsule) {
-            if (collide::capsuleVsSphere(B.position, B.orientation, B.collider.capsule, A.position, A.collider.sphere, specMargin, c))
+            if (collide::capsuleVsSphere(pB, qB, B.collider.capsule, pA, A.collider.sphere, specMargin, c))
                 add(j, i, c);   // capsule(j) -> sphere(i)
         } else if (A.collider.type == T::Capsule && B.collider.type == T::Capsule) {
-            if (collide::capsuleVsCapsule(A.position, A.orientation, A.collider.capsule,
-                                          B.position, B.orientation, B.collider.capsule, specMargin, c))
+            if (collide::capsuleVsCapsule(pA, qA, A.collider.capsule,
+                                          pB, qB, B.collider.capsule, specMargin, c))
                 add(i, j, c);   // A -> B
         } else if (A.collider.type == T::Capsule && (B.collider.type == T::Box || B.collider.type == T::ConvexHull)) {
             Contact cs[2];
-            const int nc = collide::capsuleVsConvex(A.position, A.orientation, A.collider.capsule, supportOf(B), specMargin, cs);
+            ++out.gjk;
+            const int nc = collide::capsuleVsConvex(pA, qA, A.collider.capsule, supportOf(j), specMargin, cs);
             if (nc > 0) for (int k = 0; k < nc; ++k) add(j, i, cs[k]);       // convex(j) -> capsule(i)
-            else if (collide::convexVsConvex(supportOf(A), supportOf(B), c)) add(i, j, c);   // deep overlap fallback
+            else if (convex(c)) add(i, j, c);   // deep overlap fallback
         } else if ((A.collider.type == T::Box || A.collider.type == T::ConvexHull) && B.collider.type == T::Capsule) {
             Contact cs[2];
-            const int nc = collide::capsuleVsConvex(B.position, B.orientation, B.collider.capsule, supportOf(A), specMargin, cs);
+            ++out.gjk;
+            const int nc = collide::capsuleVsConvex(pB, qB, B.collider.capsule, supportOf(i), specMargin, cs);
             if (nc > 0) for (int k = 0; k < nc; ++k) add(i, j, cs[k]);       // convex(i) -> capsule(j)
-            else if (collide::convexVsConvex(supportOf(A), supportOf(B), c)) add(i, j, c);
+            else if (convex(c)) add(i, j, c);
         } else {
             const bool aPoly = (A.collider.type == T::Box || A.collider.type == T::ConvexHull);
             const bool bPoly = (B.collider.type == T::Box || B.collider.type == T::ConvexHull);
             if (aPoly && bPoly) {
                 // box-hull / hull-box / hull-hull → EPA normal + polytope face-clip manifold
-                thread_local std::vector<Vec3> va, vb;
-                worldVerts(A, va);
-                worldVerts(B, vb);
                 Contact epa;
-                if (collide::convexVsConvex(supportOf(A), supportOf(B), epa)) {
+                if (convex(epa)) {
                     Contact cs[4];
-                    const int nc = collide::polytopeManifold(va, vb, epa, cs);
+                    int nc;
+                    const collide::PolytopeView pa = polytopeOf(i), pb = polytopeOf(j);
+                    if (pa.hull && pb.hull) {
+                        nc = collide::polytopeManifold(pa, pb, epa, cs);   // faces read in place
+                    } else {
+                        thread_local std::vector<Vec3> va, vb;
+                        worldVerts(i, va);
+                        worldVerts(j, vb);
+                        nc = collide::polytopeManifold(va, vb, epa, cs);
+                    }
                     for (int k = 0; k < nc; ++k) add(i, j, cs[k]);   // normal A -> B
                 }
             } else {
                 // a curved shape is involved (sphere/capsule vs box/hull) → single EPA point
-                if (collide::convexVsConvex(supportOf(A), supportOf(B), c)) add(i, j, c);
+                if (convex(c)) add(i, j, c);
+            }
+        }
+    }
+
+    // Stages contact c (normal a -> b) in a pair's manifold (at most 4 points).
+    static void stageContact(uint32_t a, uint32_t b, const Contact& c, PairResult& out, Contact* slots) {
+        if (out.count >= 4) return;
+        out.a = a; out.b = b;
+        slots[out.count++] = c;
+    }
+
+    // The contact constraint for manifold point `index` of a pair (normal a -> b).
+    Constraint makeConstraint(uint32_t a, uint32_t b, const Contact& c, uint32_t index) const {
+        Constraint con;
+        con.a = a; con.b = b;
+        con.normal = c.normal;
+        con.point = c.point;
+        con.penetration = -c.separation;
+        const Vec3 vrel = relativeVelocity(con);
+        const Real vn = glm::dot(vrel, con.normal);
+        const Real e = std::min(bodies_[a].material.restitution, bodies_[b].material.restitution);
+        con.restitutionBias = (vn < Real(-1)) ? e * (-vn) : Real(0);
+        con.friction = std::sqrt(bodies_[a].material.friction * bodies_[b].material.friction);
+        // Stable id for warm-starting: (bodyA, bodyB, feature). The manifold's feature id names
+        // the vertex/edge/face pair behind the point, so a resting contact keeps its key when
+        // the manifold's point order shifts; single-point tests fall back to the index.
+        con.key = (static_cast<uint64_t>(a) << 40) | (static_cast<uint64_t>(b) << 16)
+                | static_cast<uint64_t>(c.feature != 0 ? c.feature & 0xFFFFu : index & 0xFFu);
+        return con;
+    }
+
+    static uint64_t pairKey(uint32_t a, uint32_t b) { return (static_cast<uint64_t>(a) << 32) | b; }
+
+    // Speculative margin (CCD): generate contacts up to the distance the pair could close this
+    // substep, so a fast body is stopped at the surface instead of tunnelling.
+    Real speculativeMargin(uint32_t i, uint32_t j, Real h) const {
+        return def_.continuousDetection
+            ? (glm::length(linVel_[i]) + glm::length(linVel_[j])) * h : Real(0);
+    }
+
+    // ---- Shape-batched narrowphase (WorldDef::batchedNarrowphase) ----
+    // Candidate pairs are bucketed by shape-pair kind with a stable counting sort, so each bucket
+    // keeps candidate order. The four cheap kinds run kLanes pairs at a time through lane kernels
+    // that mirror collide::sphereVsSphere / sphereVsPlane / capsuleVsPlane / boxVsPlane operation
+    // for operation; every other kind (GJK/EPA, clipping, capsule segments) goes through
+    // narrowphase() one pair at a time. Either way a pair writes only its own header and staging
+    // slots, so the output order, contact keys and events are those of the one-at-a-time path.
+    enum PairKind : uint8_t { kSphereSphere, kSpherePlane, kCapsulePlane, kBoxPlane, kGenericPair, kPairKinds };
+
+    PairKind pairKind(uint32_t i, uint32_t j) const {
+        using T = ColliderDesc::Type;
+        const T a = bodies_[i].collider.type, b = bodies_[j].collider.type;
+        if (a == T::Sphere && b == T::Sphere) return kSphereSphere;
+        if (a != T::Plane) return kGenericPair;   // plane pairs are listed plane first
+        if (b == T::Sphere)  return kSpherePlane;
+        if (b == T::Capsule) return kCapsulePlane;
+        if (b == T::Box)     return kBoxPlane;
+        return kGenericPair;
+    }
+
+    // Fills pairOrder_ with candidate indices grouped by kind; kind k is
+    // pairOrder_[pairKindStart_[k], pairKindStart_[k + 1]).
+    void bucketPairs() {
+        const size_t m = candidatePairs_.size();
+        pairKind_.resize(m);
+        pairKindStart_.fill(0);
+        for (size_t k = 0; k < m; ++k) {
+            const PairKind kind = def_.batchedNarrowphase
+                ? pairKind(candidatePairs_[k].first, candidatePairs_[k].second) : kGenericPair;
+            pairKind_[k] = kind;
+            ++pairKindStart_[kind + 1];
+        }
+        for (int k = 0; k < kPairKinds; ++k) pairKindStart_[k + 1] += pairKindStart_[k];
+        std::array<uint32_t, kPairKinds> cursor;
+        std::copy_n(pairKindStart_.begin(), kPairKinds, cursor.begin());
+        pairOrder_.resize(m);
+        for (size_t k = 0; k < m; ++k) pairOrder_[cursor[pairKind_[k]]++] = static_cast<uint32_t>(k);
+    }
+
+    // One lane per pair; unused lanes repeat lane 0 so every lane holds finite inputs.
+    struct alignas(32) PairLanes {
+        float c[3][kLanes], q[4][kLanes];   // finite body B (or the plane's partner): center, x y z w
+        float cA[3][kLanes];                // sphere A's center (sphere-sphere)
+        float n[3][kLanes], d[kLanes];      // plane normal / offset
+        float r[kLanes], rA[kLanes];        // radius of B (capsule/sphere), sphere A's radius
+        float he[3][kLanes];                // box half-extents, or (0, halfHeight, 0) for a capsule
+        float margin[kLanes];
+    };
+
+    static simd::Vec3L loadVec(const float (&v)[3][kLanes]) {
+        return { simd::Lanes::load(v[0]), simd::Lanes::load(v[1]), simd::Lanes::load(v[2]) };
+    }
+    static void storeVec(const simd::Vec3L& v, float (&out)[3][kLanes]) {
+        v.x.store(out[0]); v.y.store(out[1]); v.z.store(out[2]);
+    }
+
+    // q * v in glm's order: v + ((u×v)·w + u×(u×v))·2 with u = (q.x, q.y, q.z).
+    static simd::Vec3L rotate(const float (&q)[4][kLanes], const simd::Vec3L& v) {
+        using simd::Lanes;
+        const simd::Vec3L u{ Lanes::load(q[0]), Lanes::load(q[1]), Lanes::load(q[2]) };
+        const simd::Vec3L uv = simd::cross(u, v), uuv = simd::cross(u, uv);
+        return v + Lanes::splat(2.0f) * (Lanes::load(q[3]) * uv + uuv);
+    }
+
+    // Runs one batch of `count` (<= kLanes) pairs of one kind: candidatePairs_[idx[0..count)].
+    void narrowphaseLanes(PairKind kind, const uint32_t* idx, int count, Real h) {
+        using simd::Lanes; using simd::Vec3L;
+        PairLanes in;
+        for (int l = 0; l < kLanes; ++l) {
+            const auto [i, j] = candidatePairs_[idx[l < count ? l : 0]];
+            const BodyCold& B = bodies_[j];
+            const Vec3& c = position_[j];
+            const Quat& q = orientation_[j];
+            const Vec3 he = kind == kBoxPlane ? B.collider.box.halfExtents
+                          : kind == kCapsulePlane ? Vec3(0, B.collider.capsule.halfHeight, 0) : Vec3(0);
+            const Plane pl = kind == kSphereSphere ? Plane{} : bodies_[i].collider.plane;
+            for (int a = 0; a < 3; ++a) {
+                in.c[a][l] = c[a];
+                in.cA[a][l] = position_[i][a];
+                in.n[a][l] = pl.normal[a];
+                in.he[a][l] = he[a];
+            }
+            in.q[0][l] = q.x; in.q[1][l] = q.y; in.q[2][l] = q.z; in.q[3][l] = q.w;
+            in.d[l] = pl.offset;
+            in.r[l] = kind == kSphereSphere || kind == kSpherePlane ? B.collider.sphere.radius
+                    : kind == kCapsulePlane ? B.collider.capsule.radius : Real(0);
+            in.rA[l] = kind == kSphereSphere ? bodies_[i].collider.sphere.radius : Real(0);
+            in.margin[l] = speculativeMargin(i, j, h);
+        }
+
+        alignas(32) float sep[8][kLanes];
+        alignas(32) float pt[8][3][kLanes];
+        alignas(32) float nrm[3][kLanes];
+        const Vec3L c = loadVec(in.c), n = loadVec(in.n);
+        const Lanes d = Lanes::load(in.d), r = Lanes::load(in.r);
+        int points = 1;
+        switch (kind) {
+        case kSphereSphere: {   // collide::sphereVsSphere
+            const Vec3L cA = loadVec(in.cA);
+            const Lanes rA = Lanes::load(in.rA);
+            const Vec3L dv = c - cA;
+            const Lanes dist = simd::sqrt(simd::dot(dv, dv));
+            const Lanes zero = Lanes::splat(0.0f), one = Lanes::splat(1.0f);
+            const Vec3L nn = simd::select(dist > Lanes::splat(kEpsilon), dv / dist, Vec3L{ zero, one, zero });
+            (dist - (rA + r)).store(sep[0]);
+            storeVec(cA + rA * nn, pt[0]);
+            storeVec(nn, nrm);
+            break;
+        }
+        case kSpherePlane:      // collide::sphereVsPlane
+            (simd::dot(n, c) - d - r).store(sep[0]);
+            storeVec(c - r * n, pt[0]);
+            break;
+        case kCapsulePlane: {   // collide::capsuleVsPlane: endpoints c ∓ q·(0, halfHeight, 0)
+            const Vec3L axis = rotate(in.q, loadVec(in.he));
+            const Vec3L ends[2] = { c - axis, c + axis };
+            for (int k = 0; k < 2; ++k) {
+                (simd::dot(n, ends[k]) - d - r).store(sep[k]);
+                storeVec(ends[k] - r * n, pt[k]);
+            }
+            points = 2;
+            break;
+        }
+        case kBoxPlane: {       // collide::boxVsPlane corners, in its order
+            const Vec3L he = loadVec(in.he);
+            int k = 0;
+            for (int sx = -1; sx <= 1; sx += 2)
+                for (int sy = -1; sy <= 1; sy += 2)
+                    for (int sz = -1; sz <= 1; sz += 2, ++k) {
+                        const Vec3L corner = c + rotate(in.q, Vec3L{ sx < 0 ? -he.x : he.x,
+                                                                     sy < 0 ? -he.y : he.y,
+                                                                     sz < 0 ? -he.z : he.z });
+                        (simd::dot(n, corner) - d).store(sep[k]);
+                        storeVec(corner, pt[k]);
+                    }
+            points = 8;
+            break;
+        }
+        default: break;
+        }
+
+        for (int l = 0; l < count; ++l) {
+            const auto [i, j] = candidatePairs_[idx[l]];
+            PairResult& out = perPair_[idx[l]];
+            Contact* slots = &pairContacts_[4 * size_t(idx[l])];
+            out = PairResult{};
+            const Real margin = in.margin[l];
+            const Vec3 normal = kind == kSphereSphere ? Vec3(nrm[0][l], nrm[1][l], nrm[2][l])
+                                                      : bodies_[i].collider.plane.normal;
+            // The points within the margin, tagged with their point index on the plane kinds;
+            // a box keeps its 4 deepest, picked as collide::pointsVsPlane does.
+            Contact cand[8];
+            int nc = 0;
+            for (int k = 0; k < points; ++k) {
+                if (!(sep[k][l] <= margin)) continue;
+                Contact& ct = cand[nc++];
+                ct.normal = normal;
+                ct.point = Vec3(pt[k][0][l], pt[k][1][l], pt[k][2][l]);
+                ct.separation = sep[k][l];
+                ct.touching = true;
+                ct.feature = kind == kSphereSphere || kind == kSpherePlane ? 0u : 0x8000u | static_cast<uint32_t>(k);
+            }
+            const int keep = std::min(nc, 4);
+            for (int k = 0; k < keep; ++k) {
+                if (kind == kBoxPlane) {
+                    int best = k;
+                    for (int t = k + 1; t < nc; ++t)
+                        if (cand[t].separation < cand[best].separation) best = t;
+                    std::swap(cand[k], cand[best]);
+                }
+                stageContact(i, j, cand[k], out, slots);
             }
         }
     }
 
     Vec3 relativeVelocity(const Constraint& c) const {
-        const BodyData& A = bodies_[c.a];
-        const BodyData& B = bodies_[c.b];
-        const Vec3 rA = c.point - A.position;
-        const Vec3 rB = c.point - B.position;
-        return (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
-    }
-
-    void solveConstraint(Constraint& c) {
-        BodyData& A = bodies_[c.a];
-        BodyData& B = bodies_[c.b];
-        const Vec3 rA = c.point - A.position;
-        const Vec3 rB = c.point - B.position;
-        const Mat3& IinvA = worldInvInertia_[c.a];
-        const Mat3& IinvB = worldInvInertia_[c.b];
+        const uint32_t a = c.a, b = c.b;
+        const Vec3 rA = c.point - position_[a];
+        const Vec3 rB = c.point - position_[b];
+        return velocityAt(b, rB) - velocityAt(a, rA);
+    }
+
+    // Returns the larger of the normal and friction impulse changes.
+    Real solveConstraint(Constraint& c) {
+        const uint32_t a = c.a, b = c.b;
+        const Vec3 rA = c.point - position_[a];
+        const Vec3 rB = c.point - position_[b];
+        const Mat3& IinvA = worldInvInertia_[a];
+        const Mat3& IinvB = worldInvInertia_[b];
         const Vec3& n = c.normal;
+        Real residual = 0;
 
         // --- normal impulse ---
         {
-            const Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB))
-                            - (A.linVel + glm::cross(A.angVel, rA));
+            const Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             const Real vn = glm::dot(vrel, n);
-            const Real kn = effectiveMass(A, B, IinvA, IinvB, rA, rB, n);
+            const Real kn = effectiveMass(a, b, IinvA, IinvB, rA, rB, n);
             // Target normal velocity the REAL-velocity solve drives toward. With split-impulse the
             // penetration push-out is NOT applied here (it would inject energy — the outward bias
             // velocity would persist); it is handled by the separate pseudo-velocity position pass
-            // (solvePositionColored). Here we only enforce non-penetration of velocity + restitution:
+            // (solvePositionConstraint). Here we only enforce non-penetration of velocity + restitution:
             //  * Overlapping → target 0 (or the restitution rebound), NO Baumgarte term.
             //  * Separated (speculative) → rebound if bouncing, else permit approach only up to the
             //    current gap this substep (prevents tunnelling without floating).
-            Real target;
-            if (c.penetration >= Real(0)) {
-                if (def_.splitImpulse) {
-                    target = c.restitutionBias;   // split-impulse: penetration handled in the position pass
-                } else {
-                    // Legacy Baumgarte: fold the softened, clamped push-out into the real velocity.
-                    const Real baumgarte = std::min(
-                        (def_.solver.contactBaumgarte / kSubDt_) * std::max(c.penetration - def_.solver.contactSlop, Real(0)),
-                        def_.solver.maxCorrection);
-                    target = baumgarte + c.restitutionBias;
-                }
-            } else {
-                const Real speculative = c.penetration / kSubDt_;   // = -gap/h (negative)
-                target = (c.restitutionBias > Real(0)) ? c.restitutionBias : speculative;
-            }
+            const Real target = contactTarget(c);
             Real lambda = (kn > kEpsilon) ? (target - vn) / kn : Real(0);
 
             const Real oldImpulse = c.normalImpulse;
             c.normalImpulse = std::max(oldImpulse + lambda, Real(0));
             lambda = c.normalImpulse - oldImpulse;
-            applyImpulse(A, B, IinvA, IinvB, rA, rB, lambda * n);
+            applyImpulse(a, b, IinvA, IinvB, rA, rB, lambda * n);
+            residual = std::abs(lambda);
         }
 
         // --- friction impulse ---
         {
-            const Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB))
-                            - (A.linVel + glm::cross(A.angVel, rA));
+            const Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             Vec3 vt = vrel - glm::dot(vrel, n) * n;
             const Real vtLen = glm::length(vt);
             if (vtLen > kEpsilon) {
                 const Vec3 t = vt / vtLen;
-                const Real kt = effectiveMass(A, B, IinvA, IinvB, rA, rB, t);
+                const Real kt = effectiveMass(a, b, IinvA, IinvB, rA, rB, t);
                 Real lambdaT = (kt > kEpsilon) ? -glm::dot(vrel, t) / kt : Real(0);
 
-                const Real mu = std::sqrt(A.material.friction * B.material.friction);
-                const Real maxF = mu * c.normalImpulse;
-                const Real oldT = c.tangentImpulse;
-                c.tangentImpulse = std::clamp(oldT + lambdaT, -maxF, maxF);
-                lambdaT = c.tangentImpulse - oldT;
-                applyImpulse(A, B, IinvA, IinvB, rA, rB, lambdaT * t);
+                // Accumulate as a VECTOR and clamp to the circular cone |T| ≤ μN. A scalar along
+                // the current slip direction is wrong once that direction turns between
+                // iterations: the old impulse lay along the old t, so clamping oldT + λ and
+                // applying the difference along the new t pushes the contact the wrong way
+                // (energy injection — visible once a warm-started normal impulse relaxes maxF).
+                const Real maxF = c.friction * c.normalImpulse;
+                const Vec3 oldT = c.tangentImpulse;
+                Vec3 tImp = oldT + lambdaT * t;
+                const Real tLen = std::sqrt(glm::dot(tImp, tImp));
+                if (maxF < tLen) tImp = (maxF / tLen) * tImp;
+                c.tangentImpulse = tImp;
+                const Vec3 P = tImp - oldT;
+                applyImpulse(a, b, IinvA, IinvB, rA, rB, P);
+                residual = std::max(residual, std::sqrt(glm::dot(P, P)));
             }
         }
+        return residual;
     }
 
     // Split-impulse position correction: resolve penetration on a SEPARATE pseudo-velocity
     // (biasLin_/biasAng_) that moves positions during integration but is discarded afterward — so
     // depenetration never adds to the body's real velocity (no Baumgarte energy injection). Uses the
     // same effective mass + the softened, slop-tolerant, clamped push-out target as before.
-    void solvePositionConstraint(Constraint& c) {
-        if (c.penetration <= def_.solver.contactSlop) return;
-        BodyData& A = bodies_[c.a];
-        BodyData& B = bodies_[c.b];
-        const Vec3 rA = c.point - A.position;
-        const Vec3 rB = c.point - B.position;
-        const Mat3& IinvA = worldInvInertia_[c.a];
-        const Mat3& IinvB = worldInvInertia_[c.b];
+    Real solvePositionConstraint(Constraint& c) {
+        if (c.penetration <= def_.solver.contactSlop) return Real(0);
+        const uint32_t a = c.a, b = c.b;
+        const Vec3 rA = c.point - position_[a];
+        const Vec3 rB = c.point - position_[b];
+        const Mat3& IinvA = worldInvInertia_[a];
+        const Mat3& IinvB = worldInvInertia_[b];
         const Vec3& n = c.normal;
-        const Vec3 vbias = (biasLin_[c.b] + glm::cross(biasAng_[c.b], rB))
-                         - (biasLin_[c.a] + glm::cross(biasAng_[c.a], rA));
+        const Vec3 vbias = (biasLin_[b] + glm::cross(biasAng_[b], rB))
+                         - (biasLin_[a] + glm::cross(biasAng_[a], rA));
         const Real vn = glm::dot(vbias, n);
-        const Real kn = effectiveMass(A, B, IinvA, IinvB, rA, rB, n);
+        const Real kn = effectiveMass(a, b, IinvA, IinvB, rA, rB, n);
         const Real target = std::min(
             (def_.solver.contactBaumgarte / kSubDt_) * (c.penetration - def_.solver.contactSlop),
             def_.solver.maxCorrection);
@@ -822,52 +1907,33 @@ private:
         c.pseudoImpulse = std::max(old + lambda, Real(0));   // one-sided (push apart only)
         lambda = c.pseudoImpulse - old;
         const Vec3 P = lambda * n;
-        if (A.invMass != Real(0)) { biasLin_[c.a] -= A.invMass * P; biasAng_[c.a] -= IinvA * glm::cross(rA, P); }
-        if (B.invMass != Real(0)) { biasLin_[c.b] += B.invMass * P; biasAng_[c.b] += IinvB * glm::cross(rB, P); }
-    }
-
-    // One graph-colored Gauss-Seidel sweep of the position (pseudo-velocity) solve — same coloring
-    // and parallel structure as solveColored (disjoint dynamic bodies per color).
-    void solvePositionColored() {
-        for (uint32_t col = 0; col < numColors_; ++col) {
-            const uint32_t begin = colorStart_[col];
-            const uint32_t count = colorStart_[col + 1] - begin;
-            auto solveOne = [&](size_t t) { solvePositionConstraint(constraints_[ordered_[begin + t]]); };
-            if (pool_ && count >= threshold_) pool_->parallelFor(count, solveOne, 64);
-            else for (uint32_t t = 0; t < count; ++t) solveOne(t);
-        }
+        if (const Real im = invMass_[a]; im != Real(0)) { biasLin_[a] -= im * P; biasAng_[a] -= IinvA * glm::cross(rA, P); }
+        if (const Real im = invMass_[b]; im != Real(0)) { biasLin_[b] += im * P; biasAng_[b] += IinvB * glm::cross(rB, P); }
+        return std::abs(lambda);
     }
 
     // Contact warm-starting: seed each contact's accumulated normal impulse from the persistent
     // cache and APPLY it to the bodies before iterating, so the velocity solve starts from the prior
-    // solution (essential for stack convergence). Graph-colored for parallel safety. Normal-only
-    // (tangent restarts at 0 — its direction isn't cached). No-op when the flag is off.
-    void warmStartColored() {
+    // solution (essential for stack convergence). One color run at a time, for parallel safety.
+    // Normal-only (tangent restarts at 0 — its direction isn't cached). No-op when the flag is off.
+    void warmStartRun(uint32_t r, bool par) {
         if (!def_.contactWarmStart) return;
-        for (uint32_t col = 0; col < numColors_; ++col) {
-            const uint32_t begin = colorStart_[col];
-            const uint32_t count = colorStart_[col + 1] - begin;
-            auto one = [&](size_t t) {
-                Constraint& c = constraints_[ordered_[begin + t]];
-                auto it = contactCache_.find(c.key);
-                if (it == contactCache_.end()) return;
-                c.normalImpulse = it->second.n;
-                BodyData& A = bodies_[c.a];
-                BodyData& B = bodies_[c.b];
-                applyImpulse(A, B, worldInvInertia_[c.a], worldInvInertia_[c.b],
-                             c.point - A.position, c.point - B.position, c.normalImpulse * c.normal);
-            };
-            if (pool_ && count >= threshold_) pool_->parallelFor(count, one, 64);
-            else for (uint32_t t = 0; t < count; ++t) one(t);
-        }
+        forEachInRun(r, par, [&](uint32_t ci) {
+            Constraint& c = constraints_[ci];
+            const ContactCache<>::Entry* cached = contactCache_.find(c.key);
+            if (!cached) return;
+            c.normalImpulse = cached->value;
+            const uint32_t a = c.a, b = c.b;
+            applyImpulse(a, b, worldInvInertia_[a], worldInvInertia_[b],
+                         c.point - position_[a], c.point - position_[b], c.normalImpulse * c.normal);
+        });
     }
 
     // Store each contact's solved normal impulse back into the cache (stamped) for next-substep/step
-    // warm-starting. Serial (map writes); keyed, so order-independent.
+    // warm-starting. Serial (table writes); keyed, so order-independent.
     void storeContactImpulses() {
         if (!def_.contactWarmStart) return;
-        for (const Constraint& c : constraints_)
-            contactCache_[c.key] = CachedContact{ c.normalImpulse, contactStamp_ };
+        for (const Constraint& c : constraints_) contactCache_.store(c.key, c.normalImpulse, contactStamp_);
     }
 
     // ================= TGS-Soft contact solver (WorldDef::contactSolver == TGSSoft) =================
@@ -900,30 +1966,28 @@ private:
         for (size_t i = 0; i < constraints_.size(); ++i) {
             const Constraint& con = constraints_[i];
             TgsContact& tc = tgs_[i];
-            BodyData& A = bodies_[con.a];
-            BodyData& B = bodies_[con.b];
+            const uint32_t a = con.a, b = con.b;
             tc.a = con.a; tc.b = con.b; tc.n = con.normal; tc.key = con.key;
             basisPerp(tc.n, tc.t1, tc.t2);
-            tc.localAnchorA = glm::conjugate(A.orientation) * (con.point - A.position);
-            tc.localAnchorB = glm::conjugate(B.orientation) * (con.point - B.position);
+            tc.localAnchorA = glm::conjugate(orientation_[a]) * (con.point - position_[a]);
+            tc.localAnchorB = glm::conjugate(orientation_[b]) * (con.point - position_[b]);
             tc.sep0 = -con.penetration;
-            const Vec3 rA = con.point - A.position;
-            const Vec3 rB = con.point - B.position;
-            const Mat3& IA = worldInvInertia_[con.a];
-            const Mat3& IB = worldInvInertia_[con.b];
-            const Real kn  = effectiveMass(A, B, IA, IB, rA, rB, tc.n);
-            const Real kt1 = effectiveMass(A, B, IA, IB, rA, rB, tc.t1);
-            const Real kt2 = effectiveMass(A, B, IA, IB, rA, rB, tc.t2);
+            const Vec3 rA = con.point - position_[a];
+            const Vec3 rB = con.point - position_[b];
+            const Mat3& IA = worldInvInertia_[a];
+            const Mat3& IB = worldInvInertia_[b];
+            const Real kn  = effectiveMass(a, b, IA, IB, rA, rB, tc.n);
+            const Real kt1 = effectiveMass(a, b, IA, IB, rA, rB, tc.t1);
+            const Real kt2 = effectiveMass(a, b, IA, IB, rA, rB, tc.t2);
             tc.nMass  = kn  > kEpsilon ? Real(1) / kn  : Real(0);
             tc.t1Mass = kt1 > kEpsilon ? Real(1) / kt1 : Real(0);
             tc.t2Mass = kt2 > kEpsilon ? Real(1) / kt2 : Real(0);
-            const Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
+            const Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             tc.relVN0 = glm::dot(vrel, tc.n);
-            tc.e  = std::min(A.material.restitution, B.material.restitution);
-            tc.mu = std::sqrt(A.material.friction * B.material.friction);
+            tc.e  = std::min(bodies_[a].material.restitution, bodies_[b].material.restitution);
+            tc.mu = con.friction;
             if (def_.contactWarmStart) {
-                auto it = contactCache_.find(tc.key);
-                if (it != contactCache_.end()) tc.nImp = it->second.n;
+                if (const ContactCache<>::Entry* cached = contactCache_.find(tc.key)) tc.nImp = cached->value;
             }
         }
     }
@@ -934,31 +1998,30 @@ private:
             const uint32_t count = colorStart_[col + 1] - begin;
             auto one = [&](size_t t) {
                 TgsContact& c = tgs_[ordered_[begin + t]];
-                BodyData& A = bodies_[c.a];
-                BodyData& B = bodies_[c.b];
-                const Vec3 rA = A.orientation * c.localAnchorA;
-                const Vec3 rB = B.orientation * c.localAnchorB;
+                const uint32_t a = c.a, b = c.b;
+                const Vec3 rA = orientation_[a] * c.localAnchorA;
+                const Vec3 rB = orientation_[b] * c.localAnchorB;
                 const Vec3 P = c.nImp * c.n + c.t1Imp * c.t1 + c.t2Imp * c.t2;
-                applyImpulse(A, B, worldInvInertia_[c.a], worldInvInertia_[c.b], rA, rB, P);
+                applyImpulse(a, b, worldInvInertia_[a], worldInvInertia_[b], rA, rB, P);
             };
-            if (pool_ && count >= threshold_) pool_->parallelFor(count, one, 64);
+            if (pool_ && count >= threshold_ && col != tailColor_) pool_->parallelFor(count, one, 64);
             else for (uint32_t t = 0; t < count; ++t) one(t);
         }
     }
 
     // One TGS contact sweep. useBias applies the soft position bias (penetration push-out); the relax
     // pass runs with useBias=false so the bias-added velocity is removed (energy-free depenetration).
-    void solveTgsContact(TgsContact& c, bool useBias, Real h) {
-        BodyData& A = bodies_[c.a];
-        BodyData& B = bodies_[c.b];
-        const Mat3& IA = worldInvInertia_[c.a];
-        const Mat3& IB = worldInvInertia_[c.b];
-        const Vec3 rA = A.orientation * c.localAnchorA;
-        const Vec3 rB = B.orientation * c.localAnchorB;
-        const Real sep = c.sep0 + glm::dot((B.position + rB) - (A.position + rA), c.n);
+    Real solveTgsContact(TgsContact& c, bool useBias, Real h) {
+        const uint32_t a = c.a, b = c.b;
+        const Mat3& IA = worldInvInertia_[a];
+        const Mat3& IB = worldInvInertia_[b];
+        const Vec3 rA = orientation_[a] * c.localAnchorA;
+        const Vec3 rB = orientation_[b] * c.localAnchorB;
+        const Real sep = c.sep0 + glm::dot((position_[b] + rB) - (position_[a] + rA), c.n);
+        Real residual = 0;
 
         {   // normal
-            const Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
+            const Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             const Real vn = glm::dot(vrel, c.n);
             Real bias = 0, mS = 1, iS = 0;
             if (sep > Real(0)) {
@@ -970,50 +2033,54 @@ private:
             Real impulse = -c.nMass * mS * (vn + bias) - iS * c.nImp;
             const Real newImp = std::max(c.nImp + impulse, Real(0));
             impulse = newImp - c.nImp; c.nImp = newImp;
-            applyImpulse(A, B, IA, IB, rA, rB, impulse * c.n);
+            applyImpulse(a, b, IA, IB, rA, rB, impulse * c.n);
+            residual = std::abs(impulse);
         }
         {   // friction (2-axis box, clamped to the current normal impulse)
             const Real maxF = c.mu * c.nImp;
-            Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
+            Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             Real dl = -c.t1Mass * glm::dot(vrel, c.t1);
             Real old = c.t1Imp; c.t1Imp = std::clamp(old + dl, -maxF, maxF); dl = c.t1Imp - old;
-            applyImpulse(A, B, IA, IB, rA, rB, dl * c.t1);
-            vrel = (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
+            applyImpulse(a, b, IA, IB, rA, rB, dl * c.t1);
+            vrel = velocityAt(b, rB) - velocityAt(a, rA);
             dl = -c.t2Mass * glm::dot(vrel, c.t2);
+            residual = std::max(residual, std::abs(dl));
             old = c.t2Imp; c.t2Imp = std::clamp(old + dl, -maxF, maxF); dl = c.t2Imp - old;
-            applyImpulse(A, B, IA, IB, rA, rB, dl * c.t2);
+            applyImpulse(a, b, IA, IB, rA, rB, dl * c.t2);
+            residual = std::max(residual, std::abs(dl));
         }
+        return residual;
     }
 
-    void solveTgsColored(bool useBias, Real h) {
+    Real solveTgsColored(bool useBias, Real h) {
+        Real residual = 0;
         for (uint32_t col = 0; col < numColors_; ++col) {
             const uint32_t begin = colorStart_[col];
             const uint32_t count = colorStart_[col + 1] - begin;
-            auto one = [&](size_t t) { solveTgsContact(tgs_[ordered_[begin + t]], useBias, h); };
-            if (pool_ && count >= threshold_) pool_->parallelFor(count, one, 64);
-            else for (uint32_t t = 0; t < count; ++t) one(t);
+            residual = std::max(residual, maxOver(count, pool_ && count >= threshold_ && col != tailColor_, 64,
+                [&](uint32_t t) { return solveTgsContact(tgs_[ordered_[begin + t]], useBias, h); }));
         }
+        return residual;
     }
 
     void applyRestitutionTgs() {
         for (TgsContact& c : tgs_) {
             if (c.e <= Real(0) || c.relVN0 > Real(-1) || c.nImp <= Real(0)) continue;
-            BodyData& A = bodies_[c.a];
-            BodyData& B = bodies_[c.b];
-            const Vec3 rA = A.orientation * c.localAnchorA;
-            const Vec3 rB = B.orientation * c.localAnchorB;
-            const Vec3 vrel = (B.linVel + glm::cross(B.angVel, rB)) - (A.linVel + glm::cross(A.angVel, rA));
+            const uint32_t a = c.a, b = c.b;
+            const Vec3 rA = orientation_[a] * c.localAnchorA;
+            const Vec3 rB = orientation_[b] * c.localAnchorB;
+            const Vec3 vrel = velocityAt(b, rB) - velocityAt(a, rA);
             const Real vn = glm::dot(vrel, c.n);
             Real impulse = -c.nMass * (vn + c.e * c.relVN0);
             const Real newImp = std::max(c.nImp + impulse, Real(0));
             impulse = newImp - c.nImp; c.nImp = newImp;
-            applyImpulse(A, B, worldInvInertia_[c.a], worldInvInertia_[c.b], rA, rB, impulse * c.n);
+            applyImpulse(a, b, worldInvInertia_[a], worldInvInertia_[b], rA, rB, impulse * c.n);
         }
     }
 
     void storeTgsImpulses() {
         if (!def_.contactWarmStart) return;
-        for (const TgsContact& c : tgs_) contactCache_[c.key] = CachedContact{ c.nImp, contactStamp_ };
+        for (const TgsContact& c : tgs_) contactCache_.store(c.key, c.nImp, contactStamp_);
     }
 
     // TGS-Soft step: manifold built once, then substep {integrate v, warm-start, solve(bias),
@@ -1024,58 +2091,71 @@ private:
         const Real h = dt / static_cast<Real>(substeps);
         kSubDt_ = h;
         computeWorldInvInertia();
+        stats_.integrateMs += timer_.lapMs();
         { ENGINE_PROFILE_SCOPE("phys.build"); buildConstraints(dt); }
         prepareJoints(h);
+        colorJoints();
+        stats_.jointColors = static_cast<int>(numJointColors_);
         { ENGINE_PROFILE_SCOPE("phys.solve"); prepareTgs(h); }
+        stats_.graphMs += timer_.lapMs();
 
         for (int s = 0; s < substeps; ++s) {
-            forEachDynamic([&](BodyData& b) { b.linVel += def_.gravity * h; });
+            forEachDynamic([&](size_t i) { linVel_[i] += def_.gravity * h; });
             applyActuators(h);
+            stats_.integrateMs += timer_.lapMs();
             {
                 ENGINE_PROFILE_SCOPE("phys.solve");
                 warmStartTgs();
-                solveJoints();
-                solveTgsColored(/*useBias=*/true, h);
+                const Real residual = std::max(solveJoints(), solveTgsColored(/*useBias=*/true, h));
+                stats_.velocityIterations = 1;   // TGS: one biased sweep per substep
+                ++stats_.velocitySweeps;
+                stats_.velocityResidual = std::max(stats_.velocityResidual, residual);
             }
+            stats_.solveMs += timer_.lapMs();
             {
                 ENGINE_PROFILE_SCOPE("phys.integrate");
                 const size_t nb = bodies_.size();
                 auto one = [&](size_t i) {
-                    BodyData& b = bodies_[i];
-                    if (!b.alive || b.type == BodyType::Static) return;
-                    b.position += b.linVel * h;
-                    b.orientation = integrateOrientation(b.orientation, b.angVel, h);
+                    if (!moving_[i]) return;
+                    position_[i] += linVel_[i] * h;
+                    orientation_[i] = integrateOrientation(orientation_[i], angVel_[i], h);
                 };
                 if (pool_ && nb >= threshold_) pool_->parallelFor(nb, one, 1024);
                 else for (size_t i = 0; i < nb; ++i) one(i);
                 // worldInvInertia_ intentionally NOT recomputed: TGS uses prepare-frame inertia for
                 // the whole step (matches the precomputed contact masses → energy-consistent).
             }
+            stats_.integrateMs += timer_.lapMs();
             { ENGINE_PROFILE_SCOPE("phys.solve"); solveTgsColored(/*useBias=*/false, h); }
+            stats_.solveMs += timer_.lapMs();
 
             if (def_.linearDamping > Real(0) || def_.angularDamping > Real(0)) {
                 const Real ld = std::max(Real(0), Real(1) - def_.linearDamping * h);
                 const Real ad = std::max(Real(0), Real(1) - def_.angularDamping * h);
-                forEachDynamic([&](BodyData& b) { b.linVel *= ld; b.angVel *= ad; });
+                forEachDynamic([&](size_t i) { linVel_[i] *= ld; angVel_[i] *= ad; });
             }
+            stats_.integrateMs += timer_.lapMs();
         }
         { ENGINE_PROFILE_SCOPE("phys.solve"); applyRestitutionTgs(); storeTgsImpulses(); }
+        stats_.solveMs += timer_.lapMs();
     }
 
-    // Static Real effectiveMass ... (below)
-    static Real effectiveMass(const BodyData& A, const BodyData& B, const Mat3& IinvA,
-                              const Mat3& IinvB, const Vec3& rA, const Vec3& rB, const Vec3& dir) {
+    // Velocity of body i's material point at world offset r from its center.
+    Vec3 velocityAt(uint32_t i, const Vec3& r) const { return linVel_[i] + glm::cross(angVel_[i], r); }
+
+    Real effectiveMass(uint32_t a, uint32_t b, const Mat3& IinvA, const Mat3& IinvB,
+                       const Vec3& rA, const Vec3& rB, const Vec3& dir) const {
         const Vec3 rnA = glm::cross(rA, dir);
         const Vec3 rnB = glm::cross(rB, dir);
-        return A.invMass + B.invMass
+        return invMass_[a] + invMass_[b]
              + glm::dot(dir, glm::cross(IinvA * rnA, rA))
              + glm::dot(dir, glm::cross(IinvB * rnB, rB));
     }
 
-    static void applyImpulse(BodyData& A, BodyData& B, const Mat3& IinvA, const Mat3& IinvB,
-                             const Vec3& rA, const Vec3& rB, const Vec3& P) {
-        if (A.invMass != Real(0)) { A.linVel -= A.invMass * P; A.angVel -= IinvA * glm::cross(rA, P); }
-        if (B.invMass != Real(0)) { B.linVel += B.invMass * P; B.angVel += IinvB * glm::cross(rB, P); }
+    void applyImpulse(uint32_t a, uint32_t b, const Mat3& IinvA, const Mat3& IinvB,
+                      const Vec3& rA, const Vec3& rB, const Vec3& P) {
+        if (const Real im = invMass_[a]; im != Real(0)) { linVel_[a] -= im * P; angVel_[a] -= IinvA * glm::cross(rA, P); }
+        if (const Real im = invMass_[b]; im != Real(0)) { linVel_[b] += im * P; angVel_[b] += IinvB * glm::cross(rB, P); }
     }
 
     // --- joint helpers (Phase B) ---
@@ -1098,24 +2178,23 @@ private:
         t2 = glm::cross(n, t1);
     }
 
-    static void applyAngularImpulse(BodyData& A, BodyData& B, const Mat3& IinvA,
-                                    const Mat3& IinvB, const Vec3& L) {
-        if (A.invMass != Real(0)) A.angVel -= IinvA * L;
-        if (B.invMass != Real(0)) B.angVel += IinvB * L;
+    void applyAngularImpulse(uint32_t a, uint32_t b, const Mat3& IinvA, const Mat3& IinvB,
+                             const Vec3& L) {
+        if (invMass_[a] != Real(0)) angVel_[a] -= IinvA * L;
+        if (invMass_[b] != Real(0)) angVel_[b] += IinvB * L;
     }
 
     // Hinge angle (about the axis, from the creation-time reference) + rate + world axis.
     struct HingeState { Vec3 axisW; Real q; Real qd; };
     HingeState hingeState(const JointData& j) const {
-        const BodyData& A = bodies_[j.a];
-        const BodyData& B = bodies_[j.b];
+        const uint32_t a = j.a, b = j.b;
         HingeState hs;
-        hs.axisW = glm::mat3_cast(A.orientation) * j.localAxisA;
-        const Quat qRel = glm::normalize(glm::conjugate(A.orientation) * B.orientation);
+        hs.axisW = glm::mat3_cast(orientation_[a]) * j.localAxisA;
+        const Quat qRel = glm::normalize(glm::conjugate(orientation_[a]) * orientation_[b]);
         const Quat qErr = glm::normalize(qRel * glm::conjugate(j.refRel));   // drift, A-local
         const Vec3 v(qErr.x, qErr.y, qErr.z);
         hs.q  = Real(2) * std::atan2(glm::dot(v, j.localAxisA), qErr.w);       // twist about axis
-        hs.qd = glm::dot(B.angVel - A.angVel, hs.axisW);
+        hs.qd = glm::dot(angVel_[b] - angVel_[a], hs.axisW);
         return hs;
     }
 
@@ -1127,11 +2206,10 @@ private:
             if (!j.alive) continue;
             if (j.actuator.mode == ActuatorMode::None) continue;
             if (j.type == JointType::Fixed) continue;   // no free DOF to actuate
-            BodyData& A = bodies_[j.a];
-            BodyData& B = bodies_[j.b];
-            if (A.invMass == Real(0) && B.invMass == Real(0)) continue;
-            const Mat3& IinvA = worldInvInertia_[j.a];
-            const Mat3& IinvB = worldInvInertia_[j.b];
+            const uint32_t a = j.a, b = j.b;
+            if (invMass_[a] == Real(0) && invMass_[b] == Real(0)) continue;
+            const Mat3& IinvA = worldInvInertia_[a];
+            const Mat3& IinvB = worldInvInertia_[b];
 
             if (j.type == JointType::Revolute) {
                 const HingeState hs = hingeState(j);
@@ -1141,22 +2219,22 @@ private:
                     + j.actuator.kd * (j.actuator.targetVel - hs.qd);
                 if (j.actuator.maxTorque > Real(0))
                     tau = std::clamp(tau, -j.actuator.maxTorque, j.actuator.maxTorque);
-                applyAngularImpulse(A, B, IinvA, IinvB, (tau * h) * hs.axisW);   // +τ→B, -τ→A
+                applyAngularImpulse(a, b, IinvA, IinvB, (tau * h) * hs.axisW);   // +τ→B, -τ→A
             } else {   // Ball: 3-DOF spherical actuation
                 Vec3 tau3;
                 if (j.actuator.mode == ActuatorMode::Torque) {
                     tau3 = j.actuator.ballTorque;
                 } else {   // PDTarget toward a desired relative orientation
-                    const Quat qRel = glm::normalize(glm::conjugate(A.orientation) * B.orientation);
+                    const Quat qRel = glm::normalize(glm::conjugate(orientation_[a]) * orientation_[b]);
                     const Quat qErr = glm::normalize(j.actuator.ballTarget * glm::conjugate(qRel));
-                    const Vec3 eWorld = glm::mat3_cast(A.orientation) * so3LogMap(qErr);   // A-local → world
-                    tau3 = j.actuator.kp * eWorld - j.actuator.kd * (B.angVel - A.angVel);
+                    const Vec3 eWorld = glm::mat3_cast(orientation_[a]) * so3LogMap(qErr);   // A-local → world
+                    tau3 = j.actuator.kp * eWorld - j.actuator.kd * (angVel_[b] - angVel_[a]);
                 }
                 if (j.actuator.maxTorque > Real(0)) {
                     const Real len = glm::length(tau3);
                     if (len > j.actuator.maxTorque) tau3 *= j.actuator.maxTorque / len;
                 }
-                applyAngularImpulse(A, B, IinvA, IinvB, tau3 * h);
+                applyAngularImpulse(a, b, IinvA, IinvB, tau3 * h);
             }
         }
     }
@@ -1172,43 +2250,50 @@ private:
                 const HingeState hs = hingeState(j);
                 jointStates_[i].q = hs.q; jointStates_[i].qd = hs.qd;
             } else if (j.type == JointType::Ball) {          // rest-relative rotvec + child-frame ω
-                const BodyData& A = bodies_[j.a];
-                const BodyData& B = bodies_[j.b];
-                const Quat qRel = glm::normalize(glm::conjugate(A.orientation) * B.orientation);
+                const uint32_t a = j.a, b = j.b;
+                const Quat qRel = glm::normalize(glm::conjugate(orientation_[a]) * orientation_[b]);
                 const Quat qDev = glm::normalize(glm::conjugate(j.refRel) * qRel);
                 jointStates_[i].rotation = so3LogMap(qDev);
-                jointStates_[i].angularVelocity = glm::mat3_cast(glm::conjugate(B.orientation)) * (B.angVel - A.angVel);
+                jointStates_[i].angularVelocity = glm::mat3_cast(glm::conjugate(orientation_[b])) * (angVel_[b] - angVel_[a]);
             }
         }
     }
 
+    // Joint drift goes to the split-impulse position pass (like contact penetration) instead of a
+    // velocity bias, whenever that pass runs: a real-velocity Baumgarte term adds energy, which
+    // kept a resting ragdoll's limbs twitching. The TGS path keeps the velocity bias.
+    bool splitJointDrift() const {
+        return def_.contactSolver == ContactSolver::SequentialImpulse && def_.splitImpulse
+            && def_.positionIterations > 0;
+    }
+
     // Cache per-substep solve data (anchor offsets, effective-mass matrices, Baumgarte bias) and
     // warm-start from the accumulated impulses. Runs once per substep before the iteration loop.
     void prepareJoints(Real h) {
         const Real invH = (h > kEpsilon) ? Real(1) / h : Real(0);
+        const bool split = splitJointDrift();
         for (JointData& j : joints_) {
             if (!j.alive) continue;
-            BodyData& A = bodies_[j.a];
-            BodyData& B = bodies_[j.b];
-            if (A.invMass == Real(0) && B.invMass == Real(0)) continue;
+            const uint32_t a = j.a, b = j.b;
+            if (invMass_[a] == Real(0) && invMass_[b] == Real(0)) continue;
 
-            const Mat3 RA = glm::mat3_cast(A.orientation);
-            const Mat3 RB = glm::mat3_cast(B.orientation);
-            const Mat3& IinvA = worldInvInertia_[j.a];
-            const Mat3& IinvB = worldInvInertia_[j.b];
+            const Mat3 RA = glm::mat3_cast(orientation_[a]);
+            const Mat3 RB = glm::mat3_cast(orientation_[b]);
+            const Mat3& IinvA = worldInvInertia_[a];
+            const Mat3& IinvB = worldInvInertia_[b];
 
             // Point-to-point: K = (imA+imB)I - skew(rA)·IinvA·skew(rA) - skew(rB)·IinvB·skew(rB).
             j.rA = RA * j.localAnchorA;
             j.rB = RB * j.localAnchorB;
             const Mat3 sA = skew(j.rA);
             const Mat3 sB = skew(j.rB);
-            const Mat3 K = Mat3(A.invMass + B.invMass) - sA * IinvA * sA - sB * IinvB * sB;
+            const Mat3 K = Mat3(invMass_[a] + invMass_[b]) - sA * IinvA * sA - sB * IinvB * sB;
             j.pointK = glm::inverse(K);
-            const Vec3 anchorA = A.position + j.rA;
-            const Vec3 anchorB = B.position + j.rB;
+            const Vec3 anchorA = position_[a] + j.rA;
+            const Vec3 anchorB = position_[b] + j.rB;
             j.pointBias = (def_.solver.jointBaumgarte * invH) * (anchorB - anchorA);   // drive anchors together
 
-            applyImpulse(A, B, IinvA, IinvB, j.rA, j.rB, j.pointImpulse);   // warm start (point)
+            applyImpulse(a, b, IinvA, IinvB, j.rA, j.rB, j.pointImpulse);   // warm start (point)
 
             if (j.type == JointType::Revolute) {
                 const Vec3 aA = RA * j.localAxisA;
@@ -1219,98 +2304,426 @@ private:
                 j.kt1 = glm::dot(j.t1, Isum * j.t1);
                 j.kt2 = glm::dot(j.t2, Isum * j.t2);
                 j.angBias = (def_.solver.jointBaumgarte * invH) * glm::cross(aA, aB);   // axis misalignment
-                applyAngularImpulse(A, B, IinvA, IinvB, j.angImpulse);       // warm start (angular)
+                applyAngularImpulse(a, b, IinvA, IinvB, j.angImpulse);       // warm start (angular)
 
-                // hinge limit (B2): one-sided constraint about the axis when past a limit.
+                // hinge limit (B2): one-sided constraint about the axis toward the nearer limit. It
+                // stays active inside the range as a speculative row (like a contact's gap): the
+                // joint may close at most the remaining angle this substep, so a hinge resting at
+                // its limit holds there instead of toggling the row on and off every substep.
+                const int wasState = j.limitState;
                 j.limitState = 0;
                 if (j.enableLimit && j.lowerLimit <= j.upperLimit) {
                     j.kAxis = glm::dot(aA, Isum * aA);
                     const Real q = hingeState(j).q;
-                    if (q <= j.lowerLimit) {
-                        j.limitState = +1;
-                        j.limitBias = (def_.solver.jointBaumgarte * invH) * (q - j.lowerLimit);   // < 0 → push up
-                    } else if (q >= j.upperLimit) {
-                        j.limitState = -1;
-                        j.limitBias = (def_.solver.jointBaumgarte * invH) * (q - j.upperLimit);   // > 0 → push down
-                    }
+                    const bool lower = q - j.lowerLimit <= j.upperLimit - q;
+                    const Real C = q - (lower ? j.lowerLimit : j.upperLimit);   // inside: > 0 lower, < 0 upper
+                    const Real open = lower ? std::max(C, Real(0)) : std::min(C, Real(0));
+                    j.limitState = lower ? +1 : -1;
+                    j.limitSpec = open * invH;
+                    j.limitBias = (def_.solver.jointBaumgarte * invH) * (C - open);   // past it: push back
                 }
-                if (j.limitState != 0) applyAngularImpulse(A, B, IinvA, IinvB, j.limitImpulse * j.axis);
-                else                   j.limitImpulse = 0;
+                if (j.limitState != wasState) j.limitImpulse = 0;   // other side (or off): restart
+                if (j.limitState != 0) applyAngularImpulse(a, b, IinvA, IinvB, j.limitImpulse * j.axis);
             } else if (j.type == JointType::Fixed) {
                 j.angK = glm::inverse(IinvA + IinvB);
-                const Quat qRel = glm::normalize(glm::conjugate(A.orientation) * B.orientation);
+                const Quat qRel = glm::normalize(glm::conjugate(orientation_[a]) * orientation_[b]);
                 const Quat qErr = glm::normalize(qRel * glm::conjugate(j.refRel));  // drift, A-local
                 j.angBias = (def_.solver.jointBaumgarte * invH) * (RA * so3LogMap(qErr));       // -> world
-                applyAngularImpulse(A, B, IinvA, IinvB, j.angImpulse);
+                applyAngularImpulse(a, b, IinvA, IinvB, j.angImpulse);
             } else {
                 j.angImpulse = Vec3(0);
             }
+            j.limitPseudo = 0;
+            if (split) {   // corrected on the pseudo-velocity instead (solveJointPosition)
+                j.pointDrift = std::exchange(j.pointBias, Vec3(0));
+                j.angDrift = std::exchange(j.angBias, Vec3(0));
+                j.limitDrift = std::exchange(j.limitBias, Real(0));
+            }
         }
     }
 
-    // One serial Gauss-Seidel sweep over joints (creation order → deterministic). Point-to-point
-    // then the type-specific angular part; each accumulates into the warm-start impulse.
-    void solveJoints() {
-        for (JointData& j : joints_) {
-            if (!j.alive) continue;
-            BodyData& A = bodies_[j.a];
-            BodyData& B = bodies_[j.b];
-            if (A.invMass == Real(0) && B.invMass == Real(0)) continue;
-            const Mat3& IinvA = worldInvInertia_[j.a];
-            const Mat3& IinvB = worldInvInertia_[j.b];
+    // ---- Joint coloring ----
+    // Joints are colored like contacts (no two of a color share a dynamic body), greedily in
+    // creation order: joints are few and persistent, so the serial pass is cheap. Joints of one
+    // color — of different articulations, or non-adjacent within one — are solved in parallel.
+    // A joint on a body that already holds kJointTail colors goes to the serial tail color
+    // kJointTail. Deterministic: the order depends on the joint set alone.
+    static constexpr uint32_t kJointTail = 63;
+
+    void colorJoints() {
+        const uint32_t nj = static_cast<uint32_t>(joints_.size());
+        jointColor_.assign(nj, kNoColor);
+        bodyJointMask_.assign(bodies_.size(), 0);
+        numJointColors_ = 0;
+        for (uint32_t ji = 0; ji < nj; ++ji) {
+            const JointData& j = joints_[ji];
+            if (!jointActive(j)) continue;
+            uint64_t used = 0;
+            if (invMass_[j.a] != Real(0)) used |= bodyJointMask_[j.a];
+            if (invMass_[j.b] != Real(0)) used |= bodyJointMask_[j.b];
+            const uint32_t col = std::min<uint32_t>(std::countr_one(used), kJointTail);
+            const uint64_t bit = col < kJointTail ? 1ull << col : 0;
+            if (invMass_[j.a] != Real(0)) bodyJointMask_[j.a] |= bit;
+            if (invMass_[j.b] != Real(0)) bodyJointMask_[j.b] |= bit;
+            jointColor_[ji] = col;
+            numJointColors_ = std::max(numJointColors_, col + 1);
+        }
+        jointColorStart_.assign(numJointColors_ + 1, 0);
+        for (const uint32_t col : jointColor_)
+            if (col != kNoColor) ++jointColorStart_[col + 1];
+        for (uint32_t c = 0; c < numJointColors_; ++c) jointColorStart_[c + 1] += jointColorStart_[c];
+        jointOrdered_.resize(jointColorStart_[numJointColors_]);
+        colorCursor_.assign(jointColorStart_.begin(), jointColorStart_.end() - 1);
+        for (uint32_t ji = 0; ji < nj; ++ji)
+            if (jointColor_[ji] != kNoColor) jointOrdered_[colorCursor_[jointColor_[ji]]++] = ji;
+    }
 
-            // Angular part first, then point-to-point last, so the anchor (linear) constraint is
-            // satisfied at the end of each iteration (angular impulses perturb the anchor velocity
-            // via ω, so solving them first and the point last converges far more stably).
-            if (j.type == JointType::Revolute) {
-                if (j.kt1 > kEpsilon) {
-                    const Vec3 wrel = B.angVel - A.angVel;
-                    const Real L = -(glm::dot(wrel, j.t1) + glm::dot(j.angBias, j.t1)) / j.kt1;
-                    const Vec3 imp = L * j.t1;
-                    j.angImpulse += imp;
-                    applyAngularImpulse(A, B, IinvA, IinvB, imp);
-                }
-                if (j.kt2 > kEpsilon) {
-                    const Vec3 wrel = B.angVel - A.angVel;
-                    const Real L = -(glm::dot(wrel, j.t2) + glm::dot(j.angBias, j.t2)) / j.kt2;
-                    const Vec3 imp = L * j.t2;
-                    j.angImpulse += imp;
-                    applyAngularImpulse(A, B, IinvA, IinvB, imp);
+    // Solves joints list[begin, end) of one color; in parallel when allowed and worth it (never
+    // for the tail color).
+    Real solveJointRange(uint32_t begin, uint32_t end, uint32_t col, const std::vector<uint32_t>& list, bool par) {
+        const uint32_t count = end - begin;
+        return maxOver(count, par && kJointCost * count >= threshold_ && col != kJointTail, 16,
+                       [&](uint32_t t) { return solveJoint(joints_[list[begin + t]]); });
+    }
+
+    // One Gauss-Seidel sweep over all joints in color order. Used by the TGS path; the SI path
+    // sweeps each island's joints in the same order.
+    Real solveJoints() {
+        Real residual = 0;
+        for (uint32_t col = 0; col < numJointColors_; ++col)
+            residual = std::max(residual, solveJointRange(jointColorStart_[col], jointColorStart_[col + 1], col,
+                                                          jointOrdered_, pool_ != nullptr));
+        return residual;
+    }
+
+    // Angular part, then point-to-point; each accumulates into the warm-start impulse. A joint
+    // in a direct tree only iterates its (one-sided) hinge limit here. Returns the largest impulse
+    // change.
+    Real solveJoint(JointData& j) {
+        if (j.direct) return solveHingeLimit(j);
+        const uint32_t a = j.a, b = j.b;
+        const Mat3& IinvA = worldInvInertia_[a];
+        const Mat3& IinvB = worldInvInertia_[b];
+        Real residual = 0;
+
+        // Angular part first, then point-to-point last, so the anchor (linear) constraint is
+        // satisfied at the end of each iteration (angular impulses perturb the anchor velocity
+        // via ω, so solving them first and the point last converges far more stably).
+        if (j.type == JointType::Revolute) {
+            if (j.kt1 > kEpsilon) {
+                const Vec3 wrel = angVel_[b] - angVel_[a];
+                const Real L = -(glm::dot(wrel, j.t1) + glm::dot(j.angBias, j.t1)) / j.kt1;
+                const Vec3 imp = L * j.t1;
+                j.angImpulse += imp;
+                applyAngularImpulse(a, b, IinvA, IinvB, imp);
+                residual = std::abs(L);
+            }
+            if (j.kt2 > kEpsilon) {
+                const Vec3 wrel = angVel_[b] - angVel_[a];
+                const Real L = -(glm::dot(wrel, j.t2) + glm::dot(j.angBias, j.t2)) / j.kt2;
+                const Vec3 imp = L * j.t2;
+                j.angImpulse += imp;
+                applyAngularImpulse(a, b, IinvA, IinvB, imp);
+                residual = std::max(residual, std::abs(L));
+            }
+            residual = std::max(residual, solveHingeLimit(j));
+        } else if (j.type == JointType::Fixed) {
+            const Vec3 wrel = angVel_[b] - angVel_[a];
+            const Vec3 imp = j.angK * (-(wrel + j.angBias));
+            j.angImpulse += imp;
+            applyAngularImpulse(a, b, IinvA, IinvB, imp);
+            residual = glm::length(imp);
+        }
+
+        // point-to-point (last)
+        {
+            const Vec3 vrel = velocityAt(b, j.rB) - velocityAt(a, j.rA);
+            const Vec3 dP = j.pointK * (-(vrel + j.pointBias));
+            j.pointImpulse += dP;
+            applyImpulse(a, b, IinvA, IinvB, j.rA, j.rB, dP);
+            residual = std::max(residual, glm::length(dP));
+        }
+        return residual;
+    }
+
+    // Hinge limit (B2): one-sided impulse about the axis (push back into range only).
+    Real solveHingeLimit(JointData& j) {
+        if (j.type != JointType::Revolute || j.limitState == 0 || j.kAxis <= kEpsilon) return Real(0);
+        const uint32_t a = j.a, b = j.b;
+        const Vec3 wrel = angVel_[b] - angVel_[a];
+        const Real wAxis = glm::dot(wrel, j.axis);
+        Real dL = -(wAxis + j.limitSpec + j.limitBias) / j.kAxis;
+        const Real old = j.limitImpulse;
+        j.limitImpulse = (j.limitState > 0) ? std::max(old + dL, Real(0))
+                                            : std::min(old + dL, Real(0));
+        dL = j.limitImpulse - old;
+        applyAngularImpulse(a, b, worldInvInertia_[a], worldInvInertia_[b], dL * j.axis);
+        return std::abs(dL);
+    }
+
+    // Position-pass counterpart of solveJointRange.
+    Real positionJointRange(uint32_t begin, uint32_t end, uint32_t col, const std::vector<uint32_t>& list, bool par) {
+        const uint32_t count = end - begin;
+        return maxOver(count, par && kJointCost * count >= threshold_ && col != kJointTail, 16,
+                       [&](uint32_t t) { return solveJointPosition(joints_[list[begin + t]]); });
+    }
+
+    // Split joint drift correction: solveJoint's rows on the pseudo-velocity (biasLin_/biasAng_),
+    // driven by the drift targets prepareJoints moved out of the velocity solve. A joint in a direct
+    // tree is corrected here too (the tree only solves velocities). Returns the largest pseudo-
+    // impulse change.
+    Real solveJointPosition(JointData& j) {
+        const uint32_t a = j.a, b = j.b;
+        const Mat3& IinvA = worldInvInertia_[a];
+        const Mat3& IinvB = worldInvInertia_[b];
+        auto applyAngular = [&](const Vec3& L) {
+            if (invMass_[a] != Real(0)) biasAng_[a] -= IinvA * L;
+            if (invMass_[b] != Real(0)) biasAng_[b] += IinvB * L;
+        };
+        Real residual = 0;
+
+        if (j.type == JointType::Revolute) {
+            if (j.kt1 > kEpsilon) {
+                const Real L = -(glm::dot(biasAng_[b] - biasAng_[a], j.t1) + glm::dot(j.angDrift, j.t1)) / j.kt1;
+                applyAngular(L * j.t1);
+                residual = std::abs(L);
+            }
+            if (j.kt2 > kEpsilon) {
+                const Real L = -(glm::dot(biasAng_[b] - biasAng_[a], j.t2) + glm::dot(j.angDrift, j.t2)) / j.kt2;
+                applyAngular(L * j.t2);
+                residual = std::max(residual, std::abs(L));
+            }
+            if (j.limitDrift != Real(0) && j.kAxis > kEpsilon) {   // past the limit only
+                Real dL = -(glm::dot(biasAng_[b] - biasAng_[a], j.axis) + j.limitDrift) / j.kAxis;
+                const Real old = j.limitPseudo;
+                j.limitPseudo = (j.limitState > 0) ? std::max(old + dL, Real(0)) : std::min(old + dL, Real(0));
+                dL = j.limitPseudo - old;
+                applyAngular(dL * j.axis);
+                residual = std::max(residual, std::abs(dL));
+            }
+        } else if (j.type == JointType::Fixed) {
+            const Vec3 L = j.angK * (-(biasAng_[b] - biasAng_[a] + j.angDrift));
+            applyAngular(L);
+            residual = glm::length(L);
+        }
+
+        const Vec3 vrel = (biasLin_[b] + glm::cross(biasAng_[b], j.rB)) - (biasLin_[a] + glm::cross(biasAng_[a], j.rA));
+        const Vec3 P = j.pointK * (-(vrel + j.pointDrift));
+        if (const Real im = invMass_[a]; im != Real(0)) { biasLin_[a] -= im * P; biasAng_[a] -= IinvA * glm::cross(j.rA, P); }
+        if (const Real im = invMass_[b]; im != Real(0)) { biasLin_[b] += im * P; biasAng_[b] += IinvB * glm::cross(j.rB, P); }
+        return std::max(residual, glm::length(P));
+    }
+
+    // ---- Direct joint trees (WorldDef::directJointSolver) ----
+    // A set of joints whose dynamic bodies and joints form a tree (at most one joint to a static /
+    // kinematic body — more would close a loop through the ground) is solved exactly each
+    // iteration instead of by Gauss-Seidel: the KKT system [M Jᵀ; J 0] over body and joint nodes
+    // is tree-structured, so JointTree factors it in linear time once per substep (after the warm
+    // start) and each iteration costs one linear solve for the impulses that zero every equality
+    // row's velocity error (+ Baumgarte bias) at once. Contacts and hinge limits still iterate on
+    // top. The root is the ground joint if there is one, else the lowest body, so no joint node is
+    // a leaf (its block would be zero). Node lists are island-major, children first.
+    static constexpr uint32_t kTreeJointBit = 0x80000000u;   // treeNode_ entry: joint (else body)
+
+    static int jointRows(const JointData& j) {
+        return j.type == JointType::Ball ? 3 : j.type == JointType::Revolute ? 5 : 6;
+    }
+
+    // Rows of joint j's velocity Jacobian for body `body` (an end of j), padded to 6×6.
+    JointTree::Block jointJacobian(const JointData& j, uint32_t body) const {
+        const Real s = body == j.b ? Real(1) : Real(-1);
+        const Vec3& r = body == j.b ? j.rB : j.rA;
+        JointTree::Block J{};
+        for (int d = 0; d < 3; ++d) J.m[d][d] = s;                       // v
+        J.m[0][4] =  s * r.z; J.m[0][5] = -s * r.y;                         // ω × r
+        J.m[1][3] = -s * r.z; J.m[1][5] =  s * r.x;
+        J.m[2][3] =  s * r.y; J.m[2][4] = -s * r.x;
+        if (j.type == JointType::Revolute) {
+            for (int d = 0; d < 3; ++d) { J.m[3][3 + d] = s * j.t1[d]; J.m[4][3 + d] = s * j.t2[d]; }
+        } else if (j.type == JointType::Fixed) {
+            for (int d = 0; d < 3; ++d) J.m[3 + d][3 + d] = s;
+        }
+        return J;
+    }
+
+    void buildJointTrees() {
+        for (JointData& j : joints_) j.direct = false;
+        islandTreeStart_.assign(numIslands_ + 1, 0);
+        if (!def_.directJointSolver || def_.contactSolver != ContactSolver::SequentialImpulse
+            || joints_.empty()) return;
+        const uint32_t nb = static_cast<uint32_t>(bodies_.size());
+        const uint32_t nj = static_cast<uint32_t>(joints_.size());
+        auto dyn = [&](uint32_t body) { return invMass_[body] != Real(0); };
+
+        // Components of the joint graph (union-find over bodies, lowest slot as root) and their
+        // body / joint / ground-joint counts; body → joints adjacency for the walk below.
+        treeUf_.resize(nb);
+        for (uint32_t i = 0; i < nb; ++i) treeUf_[i] = i;
+        auto root = [&](uint32_t i) {
+            while (treeUf_[i] != i) { treeUf_[i] = treeUf_[treeUf_[i]]; i = treeUf_[i]; }
+            return i;
+        };
+        bodyJointStart_.assign(nb + 1, 0);
+        for (const JointData& j : joints_) {
+            if (!jointActive(j)) continue;
+            if (dyn(j.a)) ++bodyJointStart_[j.a + 1];
+            if (dyn(j.b)) ++bodyJointStart_[j.b + 1];
+            if (dyn(j.a) && dyn(j.b)) {
+                const uint32_t ra = root(j.a), rb = root(j.b);
+                if (ra < rb) treeUf_[rb] = ra; else if (rb < ra) treeUf_[ra] = rb;
+            }
+        }
+        for (uint32_t i = 0; i < nb; ++i) bodyJointStart_[i + 1] += bodyJointStart_[i];
+        bodyJoints_.resize(bodyJointStart_[nb]);
+        islandCursor_.assign(bodyJointStart_.begin(), bodyJointStart_.end() - 1);
+        treeStats_.assign(nb, TreeStats{});
+        for (uint32_t ji = 0; ji < nj; ++ji) {
+            const JointData& j = joints_[ji];
+            if (!jointActive(j)) continue;
+            TreeStats& t = treeStats_[root(dyn(j.a) ? j.a : j.b)];
+            ++t.joints;
+            if (!dyn(j.a) || !dyn(j.b)) { ++t.ground; t.groundJoint = ji; }
+            if (dyn(j.a)) bodyJoints_[islandCursor_[j.a]++] = ji;
+            if (dyn(j.b)) bodyJoints_[islandCursor_[j.b]++] = ji;
+        }
+        for (uint32_t i = 0; i < nb; ++i) {
+            if (bodyJointStart_[i] == bodyJointStart_[i + 1]) continue;
+            TreeStats& t = treeStats_[root(i)];
+            ++t.bodies;
+            t.solid = t.solid && glm::determinant(worldInvInertia_[i]) > Real(0);
+        }
+        auto isTree = [&](const TreeStats& t) {
+            return t.joints > 0 && t.solid && t.ground <= 1 && t.joints + 1 == t.bodies + t.ground;
+        };
+
+        // Node ranges per island, then each tree's nodes in reverse preorder (children first).
+        for (uint32_t i = 0; i < nb; ++i)
+            if (root(i) == i && isTree(treeStats_[i]))
+                islandTreeStart_[islandOf_[i] + 1] += treeStats_[i].bodies + treeStats_[i].joints;
+        for (uint32_t k = 0; k < numIslands_; ++k) islandTreeStart_[k + 1] += islandTreeStart_[k];
+        const uint32_t total = islandTreeStart_[numIslands_];
+        treeNode_.resize(total);
+        treeX_.resize(total);
+        jointTree_.resize(total);
+        islandCursor_.assign(islandTreeStart_.begin(), islandTreeStart_.end() - 1);
+        for (uint32_t i = 0; i < nb; ++i) {
+            const TreeStats& t = treeStats_[i];
+            if (root(i) != i || !isTree(t)) continue;
+            treePre_.clear();   // {node, preorder index of parent node}
+            treePre_.push_back({ t.ground ? (t.groundJoint | kTreeJointBit) : i, -1 });
+            for (size_t q = 0; q < treePre_.size(); ++q) {   // BFS order is a valid preorder here
+                const uint32_t node = treePre_[q].first;
+                const uint32_t from = treePre_[q].second < 0 ? ~0u : treePre_[treePre_[q].second].first;
+                if (node & kTreeJointBit) {
+                    const JointData& j = joints_[node & ~kTreeJointBit];
+                    for (const uint32_t body : { j.a, j.b })
+                        if (dyn(body) && body != from) treePre_.push_back({ body, static_cast<int32_t>(q) });
+                } else {
+                    for (uint32_t e = bodyJointStart_[node]; e < bodyJointStart_[node + 1]; ++e)
+                        if ((bodyJoints_[e] | kTreeJointBit) != from)
+                            treePre_.push_back({ bodyJoints_[e] | kTreeJointBit, static_cast<int32_t>(q) });
                 }
-                // hinge limit (B2): one-sided impulse about the axis (push back into range only).
-                if (j.limitState != 0 && j.kAxis > kEpsilon) {
-                    const Vec3 wrel = B.angVel - A.angVel;
-                    const Real wAxis = glm::dot(wrel, j.axis);
-                    Real dL = -(wAxis + j.limitBias) / j.kAxis;
-                    const Real old = j.limitImpulse;
-                    j.limitImpulse = (j.limitState > 0) ? std::max(old + dL, Real(0))
-                                                        : std::min(old + dL, Real(0));
-                    dL = j.limitImpulse - old;
-                    applyAngularImpulse(A, B, IinvA, IinvB, dL * j.axis);
+            }
+            const uint32_t base = islandCursor_[islandOf_[i]];
+            const uint32_t n = static_cast<uint32_t>(treePre_.size());
+            for (uint32_t q = 0; q < n; ++q) {
+                const uint32_t at = base + n - 1 - q;
+                treeNode_[at] = treePre_[q].first;
+                jointTree_.parent(at) = treePre_[q].second < 0 ? -1 : static_cast<int32_t>(base + n - 1 - treePre_[q].second);
+                if (treePre_[q].first & kTreeJointBit) joints_[treePre_[q].first & ~kTreeJointBit].direct = true;
+            }
+            islandCursor_[islandOf_[i]] += n;
+        }
+    }
+
+    // Fills and factors island k's tree blocks for this substep. On a singular system (dependent
+    // rows) its joints fall back to the iterative solve.
+    bool factorJointTree(uint32_t k) {
+        const uint32_t begin = islandTreeStart_[k], end = islandTreeStart_[k + 1];
+        if (begin == end) return false;
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t node = treeNode_[i];
+            const int32_t p = jointTree_.parent(i);
+            JointTree::Block& D = jointTree_.diagonal(i);
+            D = JointTree::Block{};
+            if (node & kTreeJointBit) {
+                const JointData& j = joints_[node & ~kTreeJointBit];
+                for (int r = jointRows(j); r < 6; ++r) D.m[r][r] = Real(1);   // padding rows
+                if (p >= 0) jointTree_.coupling(i) = jointJacobian(j, treeNode_[p]);
+            } else {
+                const Real m = Real(1) / invMass_[node];
+                const Mat3 I = glm::inverse(worldInvInertia_[node]);
+                for (int d = 0; d < 3; ++d) D.m[d][d] = m;
+                for (int c = 0; c < 3; ++c)
+                    for (int r = 0; r < 3; ++r) D.m[3 + r][3 + c] = I[c][r];
+                if (p >= 0) {
+                    const JointTree::Block J = jointJacobian(joints_[treeNode_[p] & ~kTreeJointBit], node);
+                    JointTree::Block& E = jointTree_.coupling(i);
+                    for (int r = 0; r < 6; ++r)
+                        for (int c = 0; c < 6; ++c) E.m[r][c] = J.m[c][r];
                 }
-            } else if (j.type == JointType::Fixed) {
-                const Vec3 wrel = B.angVel - A.angVel;
-                const Vec3 imp = j.angK * (-(wrel + j.angBias));
-                j.angImpulse += imp;
-                applyAngularImpulse(A, B, IinvA, IinvB, imp);
             }
+        }
+        if (jointTree_.factor(begin, end)) return true;
+        for (uint32_t i = begin; i < end; ++i)
+            if (treeNode_[i] & kTreeJointBit) joints_[treeNode_[i] & ~kTreeJointBit].direct = false;
+        return false;
+    }
 
-            // point-to-point (last)
-            {
-                const Vec3 vrel = (B.linVel + glm::cross(B.angVel, j.rB))
-                                - (A.linVel + glm::cross(A.angVel, j.rA));
-                const Vec3 dP = j.pointK * (-(vrel + j.pointBias));
-                j.pointImpulse += dP;
-                applyImpulse(A, B, IinvA, IinvB, j.rA, j.rB, dP);
+    // One exact solve of island k's tree joints against the current velocities; returns the largest
+    // impulse it applied.
+    Real solveJointTree(uint32_t k) {
+        const uint32_t begin = islandTreeStart_[k], end = islandTreeStart_[k + 1];
+        for (uint32_t i = begin; i < end; ++i) {
+            JointTree::Vec6& x = treeX_[i];
+            x = JointTree::Vec6{};
+            if (!(treeNode_[i] & kTreeJointBit)) continue;
+            const JointData& j = joints_[treeNode_[i] & ~kTreeJointBit];
+            const Vec3 vrel = velocityAt(j.b, j.rB) - velocityAt(j.a, j.rA);
+            const Vec3 wrel = angVel_[j.b] - angVel_[j.a];
+            for (int d = 0; d < 3; ++d) x.v[d] = -(vrel[d] + j.pointBias[d]);
+            if (j.type == JointType::Revolute) {
+                x.v[3] = -(glm::dot(wrel, j.t1) + glm::dot(j.angBias, j.t1));
+                x.v[4] = -(glm::dot(wrel, j.t2) + glm::dot(j.angBias, j.t2));
+            } else if (j.type == JointType::Fixed) {
+                for (int d = 0; d < 3; ++d) x.v[3 + d] = -(wrel[d] + j.angBias[d]);
             }
         }
+        jointTree_.solve(begin, end, treeX_.data());
+        Real residual = 0;
+        for (uint32_t i = begin; i < end; ++i) {   // joint impulses λ = -x
+            if (!(treeNode_[i] & kTreeJointBit)) continue;
+            JointData& j = joints_[treeNode_[i] & ~kTreeJointBit];
+            const Real* x = treeX_[i].v;
+            const Mat3& IinvA = worldInvInertia_[j.a];
+            const Mat3& IinvB = worldInvInertia_[j.b];
+            const Vec3 P(-x[0], -x[1], -x[2]);
+            j.pointImpulse += P;
+            applyImpulse(j.a, j.b, IinvA, IinvB, j.rA, j.rB, P);
+            residual = std::max(residual, glm::length(P));
+            if (j.type == JointType::Ball) continue;
+            const Vec3 L = j.type == JointType::Revolute ? -x[3] * j.t1 - x[4] * j.t2 : Vec3(-x[3], -x[4], -x[5]);
+            j.angImpulse += L;
+            applyAngularImpulse(j.a, j.b, IinvA, IinvB, L);
+            residual = std::max(residual, glm::length(L));
+        }
+        return residual;
     }
 
     WorldDef def_;
     Real     kSubDt_ = Real(1) / Real(60);   // set per step for the Baumgarte term
     core::ThreadPool* pool_ = nullptr;
     size_t   threshold_ = 4096;
-    std::vector<BodyData>         bodies_;
+    std::vector<BodyCold>         bodies_;          // cold per-body record (see BodyCold)
+    // hot per-body state, SoA by body slot
+    std::vector<Vec3>             position_;
+    std::vector<Quat>             orientation_;
+    std::vector<Vec3>             linVel_, angVel_;
+    std::vector<Real>             invMass_;         // 0 for static, kinematic, sleeping and dead slots
+    std::vector<Mat3>             invInertiaLocal_;
+    std::vector<uint8_t>          moving_;          // alive Dynamic/Kinematic: integrated each substep
+    std::vector<Real>             sleepTimer_;      // seconds spent under the sleep thresholds
+    std::vector<uint32_t>         sleepSet_;        // sleep set of a sleeping body, else kNoSleepSet
     std::vector<uint32_t>         freeList_;
     std::vector<Constraint>       constraints_;
     std::vector<JointData>        joints_;        // persistent (Phase B)
@@ -1322,11 +2735,12 @@ private:
     // Persistent contact-impulse cache for warm-starting: contact key → last solved normal impulse
     // + a stamp (bumped each step) for lazy pruning of contacts that no longer exist. Keyed lookups
     // only (never iterated to apply impulses), so determinism comes from the fixed constraint order.
-    // NOTE: a std::unordered_map is not allocation-free / VecEnv-ideal at 100k+ scale — a follow-up
-    // should replace it with an open-addressed per-world table (see the investigation doc).
-    struct CachedContact { Real n = 0; uint32_t stamp = 0; };
-    std::unordered_map<uint64_t, CachedContact> contactCache_;
+    // Open-addressed and allocation-free once warm (contact_cache.h).
+    ContactCache<>                contactCache_;
     uint32_t                      contactStamp_ = 0;
+    // GJK temporal coherence: body pair (a << 32 | b) → the last separating axis GJK found for it
+    // (zero after an overlap). Same table and pruning as the impulse cache.
+    ContactCache<Vec3>            axisCache_;
 
     // TGS-Soft contact solver state. Manifolds are built ONCE per step (from constraints_) and reused
     // across substeps: anchors are stored body-local so the world contact point + separation are
@@ -1336,23 +2750,96 @@ private:
     std::vector<engine::Transform> poses_;
     std::vector<Vec3>             linVelOut_;
     std::vector<Vec3>             angVelOut_;
+    std::vector<uint32_t>         generation_;      // per body slot; bumped by destroyBody
+    std::vector<uint32_t>         jointGeneration_; // per joint slot; bumped by destroyJoint
     std::vector<ContactEvent>     events_;
+    StepStats                     stats_;
+    StageTimer                    timer_;           // stage laps for stats_
 
     // broadphase + narrowphase scratch (reused across steps)
     std::vector<uint32_t>            finiteIdx_;
     std::vector<Aabb>                finiteAabb_;
     std::vector<uint32_t>            planeIdx_;
     std::vector<broadphase::Pair>    pairs_;
+    broadphase::DynamicTree          tree_;   // BroadphaseKind::DynamicTree: persists across steps
     std::vector<std::pair<uint32_t, uint32_t>> candidatePairs_;
     std::vector<PairResult>          perPair_;
+    std::vector<Contact>             pairContacts_;             // 4 staging slots per candidate pair
+    std::vector<Vec3>                pairAxis_;                 // GJK separating axis per candidate pair
+    std::vector<uint8_t>             pairKind_;                 // PairKind per candidate pair
+    std::vector<uint32_t>            pairOrder_;                // candidate indices bucketed by kind
+    std::array<uint32_t, kPairKinds + 1> pairKindStart_{};
 
     // graph-coloring scratch for the parallel solver
     std::vector<uint32_t>            constraintColor_;
-    std::vector<uint64_t>            bodyColorMask_;
+    std::vector<uint32_t>            bodyConStart_, bodyCons_;   // body → constraints (CSR), by priority
+    std::vector<uint32_t>            bodyHead_, bodyRound_;      // Jones-Plassmann list heads / last round
+    std::vector<ColorMask>           bodyColorMask_;             // colors taken on each body
+    std::vector<std::array<uint32_t, 2>> conEnds_;              // constraint → dynamic bodies
+    std::vector<uint32_t>            frontier_;
+    std::vector<std::vector<uint32_t>> released_;               // per-chunk next-frontier parts
+    std::vector<uint32_t>            colorSize_;                 // balancing scratch
     std::vector<uint32_t>            ordered_;      // constraint indices grouped by color
     std::vector<uint32_t>            colorStart_;   // per-color offsets into ordered_
     std::vector<uint32_t>            colorCursor_;  // counting-sort scratch
+    std::vector<ContactBlock>        blocks_;       // wide solver: packed lanes, per color run
     uint32_t                         numColors_ = 0;
+    uint32_t                         tailColor_ = kNoColor;   // hub constraints, solved serially
+
+    // joint coloring (rebuilt each substep by colorJoints)
+    std::vector<uint32_t>            jointColor_;       // kNoColor for inactive joints
+    std::vector<uint32_t>            jointOrdered_;     // active joint slots grouped by color
+    std::vector<uint32_t>            jointColorStart_;
+    std::vector<uint64_t>            bodyJointMask_;
+    uint32_t                         numJointColors_ = 0;
+
+    // direct joint trees (rebuilt each substep by buildJointTrees; WorldDef::directJointSolver)
+    struct TreeStats {
+        uint32_t bodies = 0, joints = 0, ground = 0, groundJoint = 0;
+        bool     solid = true;   // every body has an invertible inertia
+    };
+    JointTree                        jointTree_;
+    std::vector<uint32_t>            treeNode_;         // body slot, or joint slot | kTreeJointBit
+    std::vector<JointTree::Vec6>     treeX_;            // per-node right-hand side / solution
+    std::vector<uint32_t>            islandTreeStart_;  // per-island offsets into treeNode_
+    std::vector<uint32_t>            treeUf_;           // union-find over bodies (joints only)
+    std::vector<TreeStats>           treeStats_;        // by component root
+    std::vector<uint32_t>            bodyJointStart_, bodyJoints_;   // body → active joints (CSR)
+    std::vector<std::pair<uint32_t, int32_t>> treePre_; // walk scratch: {node, parent's walk index}
+
+    // island scratch (rebuilt each substep by buildIslands)
+    std::vector<uint32_t>            ufParent_;         // union-find over body slots
+    std::vector<uint32_t>            islandOf_;         // body → island (kNoIsland if not dynamic)
+    std::vector<uint32_t>            islandCons_;       // constraint indices, island-major, color-minor
+    std::vector<uint32_t>            islandConStart_;   // per-island offsets into islandCons_
+    std::vector<uint32_t>            islandJoints_;     // joint slots, island-major, color-minor
+    std::vector<uint32_t>            islandJointStart_;
+    std::vector<uint32_t>            jointRunStart_;    // joint color runs, as runStart_ over islandJoints_
+    std::vector<uint32_t>            jointRunColor_;
+    std::vector<uint32_t>            islandJointRunStart_;
+    std::vector<uint32_t>            islandCursor_;     // counting-sort scratch
+    std::vector<uint32_t>            runStart_;         // color runs: [runStart_[r], runStart_[r+1]) of islandCons_
+    std::vector<uint32_t>            runColor_;
+    std::vector<uint32_t>            runBlockStart_;    // per-run offsets into blocks_
+    std::vector<uint32_t>            islandRunStart_;   // per-island offsets into the runs
+    std::vector<uint32_t>            largeIslands_;     // solved alone, colors across the pool
+    std::vector<uint32_t>            batchIslands_;     // small islands, grouped into pool tasks
+    std::vector<int>                 islandIters_;      // sweeps the last island pass used
+    std::vector<Real>                islandResidual_;   // residual of its final sweep
+    std::vector<uint32_t>            batchStart_;
+    size_t                           batchedWork_ = 0;
+    uint32_t                         numIslands_ = 0;
+
+    // sleeping state (persistent) + scratch
+    std::vector<std::vector<uint32_t>> sleepSets_;      // bodies of each sleeping island
+    std::vector<uint32_t>            sleepSetFree_;
+    std::vector<ContactEvent>        sleepEvents_;      // cached contacts of sleepers, re-reported
+    bool                             sleepEventsStale_ = false;
+    uint32_t                         numSleeping_ = 0;
+    size_t                           substepEventBegin_ = 0;   // events_ of the current substep
+    std::vector<uint32_t>            wakeList_;
+    std::vector<Real>                islandRest_;       // min rest time per island
+    std::vector<uint32_t>            islandSleepSet_;
 
 public:
     void setSubDt(Real h) { kSubDt_ = h; }
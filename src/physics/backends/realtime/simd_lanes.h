@@ -0,0 +1,160 @@
+//
+//  simd_lanes.h
+//  engine::physics / backends / realtime
+//
+//  Fixed-width float lanes for the wide contact solver. The width is chosen at compile time from
+//  the target ISA: AVX2 → 8 lanes, SSE2 / AArch64 NEON → 4, anything else → a plain 4-float
+//  array (the compiler may still vectorize it). Only what the solver needs is provided.
+//
+//  Every operation is a per-lane IEEE op, and min/max/clamp/select follow std::min/std::max/
+//  std::clamp exactly (including which operand wins on ties and signed zeros), so a lane computes
+//  the same bits as the scalar code given the same operation order.
+//
+
+#pragma once
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ENGINE_PHYS_LANES_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_PHYS_LANES_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ENGINE_PHYS_LANES_NEON 1
+#else
+#include <cmath>
+#endif
+
+namespace engine::physics::simd {
+
+#if defined(ENGINE_PHYS_LANES_AVX2)
+
+inline constexpr int kWidth = 8;
+inline constexpr const char* kIsa = "avx2";
+
+struct Mask  { __m256 m; };
+struct Lanes {
+    __m256 v;
+    static Lanes splat(float s) { return { _mm256_set1_ps(s) }; }
+    static Lanes load(const float* p) { return { _mm256_load_ps(p) }; }
+    void store(float* p) const { _mm256_store_ps(p, v); }
+};
+inline Lanes operator+(Lanes a, Lanes b) { return { _mm256_add_ps(a.v, b.v) }; }
+inline Lanes operator-(Lanes a, Lanes b) { return { _mm256_sub_ps(a.v, b.v) }; }
+inline Lanes operator*(Lanes a, Lanes b) { return { _mm256_mul_ps(a.v, b.v) }; }
+inline Lanes operator/(Lanes a, Lanes b) { return { _mm256_div_ps(a.v, b.v) }; }
+inline Lanes operator-(Lanes a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+inline Lanes sqrt(Lanes a) { return { _mm256_sqrt_ps(a.v) }; }
+inline Mask  operator<(Lanes a, Lanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+inline Mask  operator!=(Lanes a, Lanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ) }; }
+inline Mask  operator&(Mask a, Mask b) { return { _mm256_and_ps(a.m, b.m) }; }
+inline Lanes select(Mask m, Lanes a, Lanes b) { return { _mm256_blendv_ps(b.v, a.v, m.m) }; }
+
+#elif defined(ENGINE_PHYS_LANES_SSE2)
+
+inline constexpr int kWidth = 4;
+inline constexpr const char* kIsa = "sse2";
+
+struct Mask  { __m128 m; };
+struct Lanes {
+    __m128 v;
+    static Lanes splat(float s) { return { _mm_set1_ps(s) }; }
+    static Lanes load(const float* p) { return { _mm_load_ps(p) }; }
+    void store(float* p) const { _mm_store_ps(p, v); }
+};
+inline Lanes operator+(Lanes a, Lanes b) { return { _mm_add_ps(a.v, b.v) }; }
+inline Lanes operator-(Lanes a, Lanes b) { return { _mm_sub_ps(a.v, b.v) }; }
+inline Lanes operator*(Lanes a, Lanes b) { return { _mm_mul_ps(a.v, b.v) }; }
+inline Lanes operator/(Lanes a, Lanes b) { return { _mm_div_ps(a.v, b.v) }; }
+inline Lanes operator-(Lanes a) { return { _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)) }; }
+inline Lanes sqrt(Lanes a) { return { _mm_sqrt_ps(a.v) }; }
+inline Mask  operator<(Lanes a, Lanes b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+inline Mask  operator!=(Lanes a, Lanes b) { return { _mm_cmpneq_ps(a.v, b.v) }; }
+inline Mask  operator&(Mask a, Mask b) { return { _mm_and_ps(a.m, b.m) }; }
+inline Lanes select(Mask m, Lanes a, Lanes b) {
+    return { _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v)) };
+}
+
+#elif defined(ENGINE_PHYS_LANES_NEON)
+
+inline constexpr int kWidth = 4;
+inline constexpr const char* kIsa = "neon";
+
+struct Mask  { uint32x4_t m; };
+struct Lanes {
+    float32x4_t v;
+    static Lanes splat(float s) { return { vdupq_n_f32(s) }; }
+    static Lanes load(const float* p) { return { vld1q_f32(p) }; }
+    void store(float* p) const { vst1q_f32(p, v); }
+};
+inline Lanes operator+(Lanes a, Lanes b) { return { vaddq_f32(a.v, b.v) }; }
+inline Lanes operator-(Lanes a, Lanes b) { return { vsubq_f32(a.v, b.v) }; }
+inline Lanes operator*(Lanes a, Lanes b) { return { vmulq_f32(a.v, b.v) }; }
+inline Lanes operator/(Lanes a, Lanes b) { return { vdivq_f32(a.v, b.v) }; }
+inline Lanes operator-(Lanes a) { return { vnegq_f32(a.v) }; }
+inline Lanes sqrt(Lanes a) { return { vsqrtq_f32(a.v) }; }
+inline Mask  operator<(Lanes a, Lanes b) { return { vcltq_f32(a.v, b.v) }; }
+inline Mask  operator!=(Lanes a, Lanes b) { return { vmvnq_u32(vceqq_f32(a.v, b.v)) }; }
+inline Mask  operator&(Mask a, Mask b) { return { vandq_u32(a.m, b.m) }; }
+inline Lanes select(Mask m, Lanes a, Lanes b) { return { vbslq_f32(m.m, a.v, b.v) }; }
+
+#else   // portable fallback: plain per-lane loops
+
+inline constexpr int kWidth = 4;
+inline constexpr const char* kIsa = "scalar";
+
+struct Mask  { bool m[kWidth]; };
+struct Lanes {
+    float v[kWidth];
+    static Lanes splat(float s) { Lanes r; for (float& x : r.v) x = s; return r; }
+    static Lanes load(const float* p) { Lanes r; for (int i = 0; i < kWidth; ++i) r.v[i] = p[i]; return r; }
+    void store(float* p) const { for (int i = 0; i < kWidth; ++i) p[i] = v[i]; }
+};
+#define ENGINE_PHYS_LANES_BINOP(op)                                                        \
+    inline Lanes operator op(Lanes a, Lanes b) {                                          \
+        Lanes r; for (int i = 0; i < kWidth; ++i) r.v[i] = a.v[i] op b.v[i]; return r;    \
+    }
+ENGINE_PHYS_LANES_BINOP(+)
+ENGINE_PHYS_LANES_BINOP(-)
+ENGINE_PHYS_LANES_BINOP(*)
+ENGINE_PHYS_LANES_BINOP(/)
+#undef ENGINE_PHYS_LANES_BINOP
+inline Lanes operator-(Lanes a) { for (float& x : a.v) x = -x; return a; }
+inline Lanes sqrt(Lanes a) { for (float& x : a.v) x = std::sqrt(x); return a; }
+inline Mask  operator<(Lanes a, Lanes b) { Mask r; for (int i = 0; i < kWidth; ++i) r.m[i] = a.v[i] < b.v[i]; return r; }
+inline Mask  operator!=(Lanes a, Lanes b) { Mask r; for (int i = 0; i < kWidth; ++i) r.m[i] = a.v[i] != b.v[i]; return r; }
+inline Mask  operator&(Mask a, Mask b) { for (int i = 0; i < kWidth; ++i) a.m[i] = a.m[i] && b.m[i]; return a; }
+inline Lanes select(Mask m, Lanes a, Lanes b) { for (int i = 0; i < kWidth; ++i) b.v[i] = m.m[i] ? a.v[i] : b.v[i]; return b; }
+
+#endif
+
+// std::min / std::max / std::clamp semantics, lane-wise.
+inline Lanes min(Lanes a, Lanes b) { return select(b < a, b, a); }
+inline Lanes max(Lanes a, Lanes b) { return select(a < b, b, a); }
+inline Lanes clamp(Lanes v, Lanes lo, Lanes hi) { return select(v < lo, lo, select(hi < v, hi, v)); }
+inline Mask  operator>(Lanes a, Lanes b) { return b < a; }
+
+// 3-vector of lanes, mirroring the glm expressions the scalar solver uses (same evaluation order).
+struct Vec3L { Lanes x, y, z; };
+inline Vec3L operator+(const Vec3L& a, const Vec3L& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+inline Vec3L operator-(const Vec3L& a, const Vec3L& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+inline Vec3L operator*(Lanes s, const Vec3L& v) { return { s * v.x, s * v.y, s * v.z }; }
+inline Vec3L operator/(const Vec3L& v, Lanes s) { return { v.x / s, v.y / s, v.z / s }; }
+inline Lanes dot(const Vec3L& a, const Vec3L& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3L cross(const Vec3L& a, const Vec3L& b) {
+    return { a.y * b.z - b.y * a.z, a.z * b.x - b.z * a.x, a.x * b.y - b.x * a.y };
+}
+inline Vec3L select(Mask m, const Vec3L& a, const Vec3L& b) {
+    return { select(m, a.x, b.x), select(m, a.y, b.y), select(m, a.z, b.z) };
+}
+
+// Column-major 3×3 (m[c][r], like glm) of lanes; M * v with glm's row-sum order.
+struct Mat3L { Lanes m[3][3]; };
+inline Vec3L operator*(const Mat3L& M, const Vec3L& v) {
+    return { M.m[0][0] * v.x + M.m[1][0] * v.y + M.m[2][0] * v.z,
+             M.m[0][1] * v.x + M.m[1][1] * v.y + M.m[2][1] * v.z,
+             M.m[0][2] * v.x + M.m[1][2] * v.y + M.m[2][2] * v.z };
+}
+
+} // namespace engine::physics::simd
@@ -211,6 +211,7 @@ public:
         const uint32_t idx = static_cast<uint32_t>(links_.size());
         links_.push_back(l);
         poses_.push_back(l.world); linVel_.push_back(Vec3(0)); angVel_.push_back(Vec3(0));
+        generations_.push_back(1);   // bodies are never destroyed here
         inited_ = false;
         return BodyHandle{ idx, 1 };
     }
@@ -248,6 +249,7 @@ public:
         links_[j.child].parent = j.parent;
         links_[j.child].jointIndex = static_cast<int>(idx);
         jointStates_.push_back(JointState{});
+        jointGenerations_.push_back(1);   // joints are never destroyed here
         inited_ = false;
         return JointHandle{ idx, 1 };
     }
@@ -318,6 +320,9 @@ public:
 
     void step(Real dt) override {
         ensureInit();
+        stats_ = StepStats{};
+        StageTimer total;
+        timer_.restart();
         const Real h = dt / static_cast<Real>(substeps_);
         for (int s = 0; s < substeps_; ++s) {
             updatePoses();
@@ -335,7 +340,9 @@ public:
                 for (int a = 0; a < 3; ++a) baseTwist_.d[a] *= aa;   // angular part
                 for (int a = 3; a < 6; ++a) baseTwist_.d[a] *= la;   // linear part
             }
+            stats_.integrateMs += timer_.lapMs();
             solveContacts(h);
+            stats_.solveMs += timer_.lapMs();
             for (Joint& j : joints_) {                          // integrate positions
                 if (j.dof == 0) continue;
                 Vec3 wc(0);
@@ -343,15 +350,20 @@ public:
                 j.locRot = glm::normalize(j.locRot * quatFromRotvec(wc * h));
             }
             if (floating_) integrateBasePose(h);
+            stats_.integrateMs += timer_.lapMs();
         }
         updatePoses(); computeVelocities(); writeJointStates();
+        stats_.totalMs = total.lapMs();
     }
 
     std::span<const engine::Transform> poses() const override { return poses_; }
     std::span<const Vec3> linearVelocities() const override { return linVel_; }
     std::span<const Vec3> angularVelocities() const override { return angVel_; }
+    std::span<const uint32_t> bodyGenerations() const override { return generations_; }
+    std::span<const uint32_t> jointGenerations() const override { return jointGenerations_; }
     engine::Transform pose(BodyHandle h) const override { return h.index < poses_.size() ? poses_[h.index] : engine::Transform{}; }
     std::span<const ContactEvent> contacts() const override { return contacts_; }
+    const StepStats& stepStats() const override { return stats_; }
 
 private:
     void ensureInit() {
@@ -623,6 +635,8 @@ private:
 
     void solveContacts(Real h) {
         const std::vector<Contact> contacts = detectContacts();
+        stats_.contacts += static_cast<long>(contacts.size());
+        stats_.narrowphaseMs += timer_.lapMs();
         // Active revolute joint limits (impulse-based, one-sided): a DOF past a limit becomes a
         // normal-like constraint pushing it back into range — solved with the contacts so the
         // impulse propagates through H⁻¹ to the whole articulation (momentum-consistent).
@@ -683,14 +697,21 @@ private:
             lrows.push_back(std::move(lr));
         }
 
-        const int kIters = solver_.pgsIterations;                     // warm-started + block friction
-        for (int it = 0; it < kIters; ++it) {
+        // Warm-started + block friction. A velocityTolerance replaces the fixed sweep count with an
+        // early-out on the largest impulse change of a sweep.
+        const bool adaptive = solver_.velocityTolerance > Real(0);
+        const int  kIters = adaptive ? solver_.maxVelocityIterations : solver_.pgsIterations;
+        int  iters = 0;
+        Real residual = 0;
+        while (iters < kIters) {
+            residual = 0;
             for (Row& r : rows) {
                 if (r.An > kEps) {                                    // normal (λ ≥ 0)
                     const Real vn = dotN(r.Jn, qd);
                     Real dl = -(vn + r.biasN) / r.An;
                     const Real nl = std::max(Real(0), r.ln + dl);
                     dl = nl - r.ln; r.ln = nl;
+                    residual = std::max(residual, std::fabs(dl));
                     for (int i = 0; i < nd; ++i) qd[i] += r.JnHi[i] * dl;
                 }
                 // #4 friction as a coupled 2×2 block with circular cone projection (radius μλn).
@@ -709,6 +730,7 @@ private:
                 const Real mag = std::sqrt(n1 * n1 + n2 * n2);
                 if (mag > muN && mag > kEps) { const Real s = muN / mag; n1 *= s; n2 *= s; }
                 const Real ad1 = n1 - r.l1, ad2 = n2 - r.l2; r.l1 = n1; r.l2 = n2;
+                residual = std::max(residual, std::sqrt(ad1 * ad1 + ad2 * ad2));
                 for (int i = 0; i < nd; ++i) qd[i] += r.Jt1Hi[i] * ad1 + r.Jt2Hi[i] * ad2;
             }
             for (LRow& lr : lrows) {                                  // joint limits (λ ≥ 0)
@@ -717,9 +739,15 @@ private:
                 Real dl = -(vn + lr.bias) / lr.A;
                 const Real nl = std::max(Real(0), lr.l + dl);
                 dl = nl - lr.l; lr.l = nl;
+                residual = std::max(residual, std::fabs(dl));
                 for (int i = 0; i < nd; ++i) qd[i] += lr.JlHi[i] * dl;
             }
+            ++iters;
+            if (adaptive && residual <= solver_.velocityTolerance) break;
         }
+        stats_.velocityIterations = std::max(stats_.velocityIterations, iters);
+        stats_.velocitySweeps += iters;
+        stats_.velocityResidual = std::max(stats_.velocityResidual, residual);
 
         // Persist impulses for next-substep warm-starting (stale keys drop out).
         std::unordered_map<uint32_t, std::array<Real, 3>> next;
@@ -793,9 +821,13 @@ private:
     std::vector<Joint> joints_;
     std::vector<engine::Transform> poses_;
     std::vector<Vec3>  linVel_, angVel_;
+    std::vector<uint32_t> generations_;
+    std::vector<uint32_t> jointGenerations_;
     std::vector<JointState> jointStates_;
     std::vector<ContactEvent> contacts_;
     std::unordered_map<uint32_t, std::array<Real, 3>> impulseCache_;   // warm-start: key → (λn,λt1,λt2)
+    StepStats  stats_;
+    StageTimer timer_;   // stage laps for stats_
 };
 
 } // namespace
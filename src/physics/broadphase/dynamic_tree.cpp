@@ -0,0 +1,235 @@
+//
+//  dynamic_tree.cpp
+//  engine::physics / broadphase
+//
+//  Insertion picks the sibling by the surface-area heuristic (walk down while descending is
+//  cheaper than pairing with the current node) and rebalances with AVL-style rotations on the
+//  way up, as in Box2D's b2DynamicTree. Nodes live in one array with a free list, so proxies
+//  keep their node index for life and reinsertion allocates nothing in steady state.
+//
+
+#include "engine/physics/broadphase/dynamic_tree.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace engine::physics::broadphase {
+namespace {
+
+Aabb merged(const Aabb& a, const Aabb& b) { return { glm::min(a.min, b.min), glm::max(a.max, b.max) }; }
+
+// Half the surface area — the SAH cost; only relative values matter.
+Real area(const Aabb& a) {
+    const Vec3 e = a.max - a.min;
+    return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+bool contains(const Aabb& outer, const Aabb& inner) {
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z
+        && inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+} // namespace
+
+int32_t DynamicTree::allocate() {
+    if (free_ < 0) {
+        nodes_.emplace_back();
+        return static_cast<int32_t>(nodes_.size() - 1);
+    }
+    const int32_t n = free_;
+    free_ = nodes_[n].parent;
+    nodes_[n] = Node{};
+    return n;
+}
+
+void DynamicTree::release(int32_t n) {
+    nodes_[n].height = -1;
+    nodes_[n].parent = free_;
+    free_ = n;
+}
+
+void DynamicTree::refit(int32_t n) {
+    Node& p = nodes_[n];
+    p.height = 1 + std::max(nodes_[p.left].height, nodes_[p.right].height);
+    p.box = merged(nodes_[p.left].box, nodes_[p.right].box);
+}
+
+void DynamicTree::insertLeaf(int32_t leaf) {
+    if (root_ < 0) {
+        root_ = leaf;
+        nodes_[leaf].parent = -1;
+        return;
+    }
+    const Aabb box = nodes_[leaf].box;
+    int32_t index = root_;
+    while (!nodes_[index].leaf()) {
+        const Node& n = nodes_[index];
+        const Real combined = area(merged(n.box, box));
+        const Real cost = Real(2) * combined;                          // new parent here
+        const Real inherit = Real(2) * (combined - area(n.box));       // growth pushed to ancestors
+        auto descend = [&](int32_t c) {
+            const Node& ch = nodes_[c];
+            const Real grown = area(merged(box, ch.box));
+            return (ch.leaf() ? grown : grown - area(ch.box)) + inherit;
+        };
+        const Real costL = descend(n.left);
+        const Real costR = descend(n.right);
+        if (cost < costL && cost < costR) break;
+        index = costL < costR ? n.left : n.right;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = nodes_[sibling].parent;
+    const int32_t parent = allocate();
+    nodes_[parent].parent = oldParent;
+    nodes_[parent].box = merged(box, nodes_[sibling].box);
+    nodes_[parent].height = nodes_[sibling].height + 1;
+    nodes_[parent].left = sibling;
+    nodes_[parent].right = leaf;
+    if (oldParent < 0) root_ = parent;
+    else if (nodes_[oldParent].left == sibling) nodes_[oldParent].left = parent;
+    else nodes_[oldParent].right = parent;
+    nodes_[sibling].parent = parent;
+    nodes_[leaf].parent = parent;
+
+    for (int32_t i = nodes_[leaf].parent; i >= 0; i = nodes_[i].parent) {
+        i = balance(i);
+        refit(i);
+    }
+}
+
+void DynamicTree::removeLeaf(int32_t leaf) {
+    if (leaf == root_) {
+        root_ = -1;
+        return;
+    }
+    const int32_t parent = nodes_[leaf].parent;
+    const int32_t grand = nodes_[parent].parent;
+    const int32_t sibling = nodes_[parent].left == leaf ? nodes_[parent].right : nodes_[parent].left;
+    release(parent);
+    if (grand < 0) {
+        root_ = sibling;
+        nodes_[sibling].parent = -1;
+        return;
+    }
+    if (nodes_[grand].left == parent) nodes_[grand].left = sibling;
+    else nodes_[grand].right = sibling;
+    nodes_[sibling].parent = grand;
+    for (int32_t i = grand; i >= 0; i = nodes_[i].parent) {
+        i = balance(i);
+        refit(i);
+    }
+}
+
+// Rotates the taller grandchild subtree up when a's children differ in height by more than 1.
+// Returns the index now at a's position.
+int32_t DynamicTree::balance(int32_t ia) {
+    Node& a = nodes_[ia];
+    if (a.leaf() || a.height < 2) return ia;
+    const int32_t ib = a.left, ic = a.right;
+    const int32_t skew = nodes_[ic].height - nodes_[ib].height;
+    if (skew >= -1 && skew <= 1) return ia;
+
+    // Promote `iu` (the taller child) over a; a keeps its other child and takes the shorter of
+    // iu's children, iu keeps the taller one.
+    const bool right = skew > 1;
+    const int32_t iu = right ? ic : ib;
+    Node& u = nodes_[iu];
+    const int32_t ix = u.left, iy = u.right;
+    const bool xTaller = nodes_[ix].height > nodes_[iy].height;
+    const int32_t keep = xTaller ? ix : iy;
+    const int32_t give = xTaller ? iy : ix;
+
+    u.left = ia;
+    u.right = keep;
+    u.parent = a.parent;
+    a.parent = iu;
+    if (u.parent < 0) root_ = iu;
+    else if (nodes_[u.parent].left == ia) nodes_[u.parent].left = iu;
+    else nodes_[u.parent].right = iu;
+
+    if (right) a.right = give;
+    else a.left = give;
+    nodes_[give].parent = ia;
+    refit(ia);
+    refit(iu);
+    return iu;
+}
+
+void DynamicTree::update(std::span<const uint32_t> ids, std::span<const Aabb> aabbs, std::vector<Pair>& pairs) {
+    pairs.clear();
+    const size_t n = ids.size();
+    if (++stamp_ == 0) {   // wrapped: forget old stamps
+        std::fill(movedStamp_.begin(), movedStamp_.end(), 0u);
+        stamp_ = 1;
+    }
+    if (n > 0 && ids.back() >= proxyOf_.size()) {
+        proxyOf_.resize(ids.back() + 1, -1);
+        indexOf_.resize(ids.back() + 1, 0);
+        movedStamp_.resize(ids.back() + 1, 0);
+    }
+
+    // Proxies whose id is no longer present.
+    for (size_t k = 0; const uint32_t id : live_) {
+        while (k < n && ids[k] < id) ++k;
+        if (k < n && ids[k] == id) continue;
+        removeLeaf(proxyOf_[id]);
+        release(proxyOf_[id]);
+        proxyOf_[id] = -1;
+    }
+
+    // New proxies, and reinsertion of those that left their fat box.
+    moved_.clear();
+    for (size_t k = 0; k < n; ++k) {
+        const uint32_t id = ids[k];
+        indexOf_[id] = static_cast<uint32_t>(k);
+        Aabb fat = aabbs[k];
+        int32_t p = proxyOf_[id];
+        if (p >= 0) {
+            if (contains(nodes_[p].box, fat)) continue;
+            removeLeaf(p);
+        } else {
+            p = allocate();
+            nodes_[p].id = id;
+            proxyOf_[id] = p;
+        }
+        fat.expand(margin_);
+        nodes_[p].box = fat;
+        insertLeaf(p);
+        movedStamp_[id] = stamp_;
+        moved_.push_back(id);
+    }
+    live_.assign(ids.begin(), ids.end());
+
+    // Drop pairs that lost a proxy or whose (moved) fat boxes separated; unmoved pairs persist.
+    kept_.clear();
+    removed_.clear();
+    for (const Pair& pr : pairs_) {
+        const int32_t pa = proxyOf_[pr.first], pb = proxyOf_[pr.second];
+        const bool gone = pa < 0 || pb < 0
+            || ((moved(pr.first) || moved(pr.second)) && !overlaps(nodes_[pa].box, nodes_[pb].box));
+        (gone ? removed_ : kept_).push_back(pr);
+    }
+
+    // New pairs can only involve a moved proxy. A moved-moved pair is found from its lower id.
+    candidates_.clear();
+    for (const uint32_t id : moved_)
+        query(nodes_[proxyOf_[id]].box, [&](uint32_t o) {
+            if (o == id || (o < id && moved(o))) return;
+            candidates_.emplace_back(std::min(id, o), std::max(id, o));
+        });
+    std::sort(candidates_.begin(), candidates_.end());
+    added_.clear();
+    std::set_difference(candidates_.begin(), candidates_.end(), kept_.begin(), kept_.end(),
+                        std::back_inserter(added_));
+    pairs_.clear();
+    std::merge(kept_.begin(), kept_.end(), added_.begin(), added_.end(), std::back_inserter(pairs_));
+
+    // Emit tight overlaps. ids ascend with k, so (id, id) order is (k, l) order.
+    for (const Pair& pr : pairs_) {
+        const uint32_t k = indexOf_[pr.first], l = indexOf_[pr.second];
+        if (overlaps(aabbs[k], aabbs[l])) pairs.emplace_back(k, l);
+    }
+}
+
+} // namespace engine::physics::broadphase
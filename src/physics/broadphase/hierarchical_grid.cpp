@@ -0,0 +1,120 @@
+//
+//  hierarchical_grid.cpp
+//  engine::physics / broadphase
+//
+//  One flat entry array for all levels: (hash(level, cell) << 32) | bodyIndex, sorted once, so a
+//  (level, cell) is a contiguous run. Same-level pairs come from the runs; a cross-level probe is
+//  a binary search for the run of a coarser cell. Only occupied levels are probed, so a scene of
+//  pebbles plus a few boulders costs one probe level per pebble, not log2(size ratio).
+//
+
+#include "engine/physics/broadphase/hierarchical_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "engine/core/threading/parallel_sort.h"
+
+namespace engine::physics::broadphase {
+namespace {
+
+constexpr int kMaxLevels = 24;   // 2^23 size ratio; anything larger shares the top level
+
+// uniformGrid's Teschner hash with the level folded in (collisions only add candidates).
+inline uint32_t cellHash(int level, int32_t x, int32_t y, int32_t z) {
+    return (static_cast<uint32_t>(x) * 73856093u)
+         ^ (static_cast<uint32_t>(y) * 19349663u)
+         ^ (static_cast<uint32_t>(z) * 83492791u)
+         ^ (static_cast<uint32_t>(level) * 2654435761u);
+}
+
+inline Real maxExtent(const Aabb& a) {
+    const Vec3 e = a.max - a.min;
+    return std::max(e.x, std::max(e.y, e.z));
+}
+
+} // namespace
+
+void hierarchicalGrid(std::span<const Aabb> aabbs, std::vector<Pair>& pairs, core::ThreadPool* pool) {
+    pairs.clear();
+    const uint32_t n = static_cast<uint32_t>(aabbs.size());
+    if (n < 2) return;
+
+    // Level 0 cell = twice the smallest non-degenerate box, so same-sized bodies whose extents
+    // differ by rounding share a level; each box goes to the first level that fits it.
+    Real base = Real(0);
+    for (const Aabb& a : aabbs) {
+        const Real e = maxExtent(a);
+        if (e >= kEpsilon && (base == Real(0) || e < base)) base = e;
+    }
+    base = base == Real(0) ? Real(1) : Real(2) * base;
+    Real inv[kMaxLevels];
+    for (int l = 0; l < kMaxLevels; ++l) inv[l] = Real(1) / std::ldexp(base, l);
+
+    thread_local std::vector<uint8_t> level;
+    level.resize(n);
+    uint32_t occupied = 0;   // bit l = level l holds a box
+    for (uint32_t i = 0; i < n; ++i) {
+        const Real e = maxExtent(aabbs[i]);
+        int l = 0;
+        while (l < kMaxLevels - 1 && e * inv[l] > Real(1)) ++l;
+        level[i] = static_cast<uint8_t>(l);
+        occupied |= 1u << l;
+    }
+
+    auto coord = [&](Real v, int l) { return static_cast<int32_t>(std::floor(v * inv[l])); };
+    // Calls f(hash) for every level-l cell the box covers.
+    auto forCells = [&](const Aabb& a, int l, auto&& f) {
+        for (int32_t x = coord(a.min.x, l); x <= coord(a.max.x, l); ++x)
+            for (int32_t y = coord(a.min.y, l); y <= coord(a.max.y, l); ++y)
+                for (int32_t z = coord(a.min.z, l); z <= coord(a.max.z, l); ++z)
+                    f(cellHash(l, x, y, z));
+    };
+
+    thread_local std::vector<uint64_t> entries;
+    entries.clear();
+    for (uint32_t i = 0; i < n; ++i)
+        forCells(aabbs[i], level[i], [&](uint32_t h) { entries.push_back((static_cast<uint64_t>(h) << 32) | i); });
+    if (pool) core::parallelSort(*pool, entries);
+    else      std::sort(entries.begin(), entries.end());
+
+    // Same level: every pair within a cell run (hash collisions can mix levels; those pairs are
+    // found by the cross-level probe instead).
+    const size_t m = entries.size();
+    for (size_t s = 0; s < m;) {
+        const uint32_t h = static_cast<uint32_t>(entries[s] >> 32);
+        size_t e = s + 1;
+        while (e < m && static_cast<uint32_t>(entries[e] >> 32) == h) ++e;
+        for (size_t a = s; a < e; ++a)
+            for (size_t b = a + 1; b < e; ++b) {
+                const uint32_t i = static_cast<uint32_t>(entries[a] & 0xffffffffu);
+                const uint32_t j = static_cast<uint32_t>(entries[b] & 0xffffffffu);
+                if (i != j && level[i] == level[j] && overlaps(aabbs[i], aabbs[j]))
+                    pairs.emplace_back(std::min(i, j), std::max(i, j));
+            }
+        s = e;
+    }
+
+    // Across levels: each box probes the cells it covers on every coarser occupied level. Its
+    // extent fits those cells, so that is at most 2 cells per axis per level.
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t up = occupied >> (level[i] + 1), l = level[i] + 1u; up != 0; up >>= 1, ++l) {
+            if (!(up & 1u)) continue;
+            forCells(aabbs[i], static_cast<int>(l), [&](uint32_t h) {
+                auto it = std::lower_bound(entries.begin(), entries.end(), static_cast<uint64_t>(h) << 32);
+                for (; it != entries.end() && static_cast<uint32_t>(*it >> 32) == h; ++it) {
+                    const uint32_t j = static_cast<uint32_t>(*it & 0xffffffffu);
+                    if (level[j] == l && overlaps(aabbs[i], aabbs[j]))
+                        pairs.emplace_back(std::min(i, j), std::max(i, j));
+                }
+            });
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());   // pairs can share cells
+}
+
+} // namespace engine::physics::broadphase
@@ -13,7 +13,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "engine/core/threading/parallel_sort.h"
@@ -29,51 +31,155 @@ inline uint32_t cellHash(int32_t x, int32_t y, int32_t z) {
          ^ (static_cast<uint32_t>(z) * 83492791u);
 }
 
-} // namespace
-
-void uniformGrid(std::span<const Aabb> aabbs, std::vector<Pair>& pairs, core::ThreadPool* pool) {
-    pairs.clear();
-    const uint32_t n = static_cast<uint32_t>(aabbs.size());
-    if (n < 2) return;
+constexpr uint32_t kPooledMinBodies = 4096;   // below this the pooled stages cost more than they save
 
+// Largest AABB extent over [b, e) — the cell size (each box spans at most 2 cells per axis).
+Real maxExtent(std::span<const Aabb> aabbs, size_t b, size_t e) {
     Real cell = Real(0);
-    for (const Aabb& a : aabbs) {
-        const Vec3 e = a.max - a.min;
-        cell = std::max(cell, std::max(e.x, std::max(e.y, e.z)));
+    for (size_t i = b; i < e; ++i) {
+        const Vec3 ext = aabbs[i].max - aabbs[i].min;
+        cell = std::max(cell, std::max(ext.x, std::max(ext.y, ext.z)));
     }
-    if (cell < kEpsilon) cell = Real(1);
-    const Real inv = Real(1) / cell;
-    auto coord = [&](Real v) { return static_cast<int32_t>(std::floor(v * inv)); };
+    return cell;
+}
 
+struct Cells {
+    Real inv;
+    int32_t coord(Real v) const { return static_cast<int32_t>(std::floor(v * inv)); }
+    uint32_t count(const Aabb& a) const {
+        return uint32_t(coord(a.max.x) - coord(a.min.x) + 1) * uint32_t(coord(a.max.y) - coord(a.min.y) + 1)
+             * uint32_t(coord(a.max.z) - coord(a.min.z) + 1);
+    }
     // entry = (cellHash << 32) | bodyIndex  → sorting groups by cell, then by body index.
-    thread_local std::vector<uint64_t> entries;
-    entries.clear();
-    for (uint32_t i = 0; i < n; ++i) {
-        const Aabb& a = aabbs[i];
+    template <class F>
+    void forEntries(const Aabb& a, uint32_t i, F&& f) const {
         for (int32_t x = coord(a.min.x); x <= coord(a.max.x); ++x)
             for (int32_t y = coord(a.min.y); y <= coord(a.max.y); ++y)
                 for (int32_t z = coord(a.min.z); z <= coord(a.max.z); ++z)
-                    entries.push_back((static_cast<uint64_t>(cellHash(x, y, z)) << 32) | i);
+                    f((static_cast<uint64_t>(cellHash(x, y, z)) << 32) | i);
     }
-    if (pool) core::parallelSort(*pool, entries);
-    else      std::sort(entries.begin(), entries.end());
+};
 
+// Pairs every distinct body in each cell run starting in [s, end) (indices already ascending).
+template <class F>
+void emitRuns(std::span<const Aabb> aabbs, const std::vector<uint64_t>& entries, size_t s, size_t end, F&& emit) {
     const size_t m = entries.size();
-    for (size_t s = 0; s < m;) {
+    while (s < end) {
         const uint32_t h = static_cast<uint32_t>(entries[s] >> 32);
         size_t e = s + 1;
         while (e < m && static_cast<uint32_t>(entries[e] >> 32) == h) ++e;
-        // Pair every distinct body in this cell run (indices already ascending).
         for (size_t a = s; a < e; ++a)
             for (size_t b = a + 1; b < e; ++b) {
                 const uint32_t i = static_cast<uint32_t>(entries[a] & 0xffffffffu);
                 const uint32_t j = static_cast<uint32_t>(entries[b] & 0xffffffffu);
-                if (i != j && overlaps(aabbs[i], aabbs[j]))
-                    pairs.emplace_back(std::min(i, j), std::max(i, j));
+                if (i != j && overlaps(aabbs[i], aabbs[j])) emit(std::min(i, j), std::max(i, j));
             }
         s = e;
     }
+}
+
+struct Scratch {
+    std::vector<Real>              extent;     // per-chunk max extent
+    std::vector<size_t>            base;       // chunk / bucket output offsets
+    std::vector<uint64_t>          entries;
+    std::vector<size_t>            runStart;   // per-chunk first entry (a run boundary)
+    std::vector<std::vector<Pair>> local;      // [chunk * B + bucket]
+    std::vector<std::vector<Pair>> bucket;
+};
+
+// Pooled path: every stage is split into fixed chunks, so the output does not depend on which
+// worker ran what. Pairs are bucketed by their first index; each bucket is sorted + de-duplicated
+// on its own and the buckets are concatenated in order — the same list as the serial sort+unique.
+void uniformGridPooled(std::span<const Aabb> aabbs, std::vector<Pair>& pairs, core::ThreadPool& pool) {
+    // Scratch is the CALLER's thread_local storage; the tasks below run on other threads, so they
+    // must reach it through these references, never by name.
+    thread_local Scratch tls;
+    Scratch& sc = tls;
+    const uint32_t n = static_cast<uint32_t>(aabbs.size());
+    const size_t T = size_t(pool.workerCount() + 1) * 4;   // work chunks
+    const size_t B = size_t(pool.workerCount() + 1) * 2;   // pair buckets (by first index)
+    auto chunk = [&](size_t t, size_t total) { return std::pair{ total * t / T, total * (t + 1) / T }; };
+
+    sc.extent.assign(T, Real(0));
+    pool.parallelFor(T, [&](size_t t) { const auto [b, e] = chunk(t, n); sc.extent[t] = maxExtent(aabbs, b, e); }, 1);
+    Real cell = *std::max_element(sc.extent.begin(), sc.extent.end());
+    if (cell < kEpsilon) cell = Real(1);
+    const Cells cells{ Real(1) / cell };
+
+    // Entries: count per chunk, exclusive scan of the chunk totals, fill each chunk's slice.
+    sc.base.assign(T + 1, 0);
+    pool.parallelFor(T, [&](size_t t) {
+        const auto [b, e] = chunk(t, n);
+        size_t sum = 0;
+        for (size_t i = b; i < e; ++i) sum += cells.count(aabbs[i]);
+        sc.base[t + 1] = sum;
+    }, 1);
+    for (size_t t = 0; t < T; ++t) sc.base[t + 1] += sc.base[t];
+    sc.entries.resize(sc.base[T]);
+    pool.parallelFor(T, [&](size_t t) {
+        const auto [b, e] = chunk(t, n);
+        size_t at = sc.base[t];
+        for (size_t i = b; i < e; ++i)
+            cells.forEntries(aabbs[i], static_cast<uint32_t>(i), [&](uint64_t entry) { sc.entries[at++] = entry; });
+    }, 1);
+    core::parallelSort(pool, sc.entries);
+
+    // Emission: T entry ranges, each starting on a run boundary, into per-(range, bucket) buffers.
+    const std::vector<uint64_t>& entries = sc.entries;
+    const size_t m = entries.size();
+    sc.runStart.assign(T + 1, m);
+    for (size_t t = 0; t < T; ++t) {
+        size_t s = std::max(m * t / T, t > 0 ? sc.runStart[t - 1] : size_t(0));
+        while (s > 0 && s < m && (entries[s] >> 32) == (entries[s - 1] >> 32)) ++s;
+        sc.runStart[t] = s;
+    }
+    sc.local.resize(T * B);
+    pool.parallelFor(T, [&](size_t t) {
+        for (size_t b = 0; b < B; ++b) sc.local[t * B + b].clear();
+        emitRuns(aabbs, entries, sc.runStart[t], sc.runStart[t + 1], [&](uint32_t i, uint32_t j) {
+            sc.local[t * B + size_t(i) * B / n].emplace_back(i, j);
+        });
+    }, 1);
+
+    // Per bucket: gather in range order, sort, unique; then concatenate the buckets in order.
+    sc.bucket.resize(B);
+    pool.parallelFor(B, [&](size_t b) {
+        std::vector<Pair>& out = sc.bucket[b];
+        out.clear();
+        for (size_t t = 0; t < T; ++t) out.insert(out.end(), sc.local[t * B + b].begin(), sc.local[t * B + b].end());
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }, 1);
+    sc.base.assign(B + 1, 0);
+    for (size_t b = 0; b < B; ++b) sc.base[b + 1] = sc.base[b] + sc.bucket[b].size();
+    pairs.resize(sc.base[B]);
+    pool.parallelFor(B, [&](size_t b) {
+        std::copy(sc.bucket[b].begin(), sc.bucket[b].end(), pairs.begin() + static_cast<std::ptrdiff_t>(sc.base[b]));
+    }, 1);
+}
+
+} // namespace
+
+void uniformGrid(std::span<const Aabb> aabbs, std::vector<Pair>& pairs, core::ThreadPool* pool) {
+    pairs.clear();
+    const uint32_t n = static_cast<uint32_t>(aabbs.size());
+    if (n < 2) return;
+    if (pool && pool->workerCount() > 0 && n >= kPooledMinBodies) {
+        uniformGridPooled(aabbs, pairs, *pool);
+        return;
+    }
+
+    Real cell = maxExtent(aabbs, 0, n);
+    if (cell < kEpsilon) cell = Real(1);
+    const Cells cells{ Real(1) / cell };
+
+    thread_local std::vector<uint64_t> entries;
+    entries.clear();
+    for (uint32_t i = 0; i < n; ++i)
+        cells.forEntries(aabbs[i], i, [&](uint64_t entry) { entries.push_back(entry); });
+    std::sort(entries.begin(), entries.end());
 
+    emitRuns(aabbs, entries, 0, entries.size(), [&](uint32_t i, uint32_t j) { pairs.emplace_back(i, j); });
     std::sort(pairs.begin(), pairs.end());
     pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());   // pairs can share cells
 }
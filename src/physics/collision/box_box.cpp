@@ -5,7 +5,9 @@
 
 #include "engine/physics/collision/box_box.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 #include <glm/gtc/quaternion.hpp>
@@ -22,8 +24,25 @@ struct Face {
     Vec3 u, w;            // in-plane unit axes
     Real hu, hw;          // half-lengths along u, w
     Vec3 v[4];            // corner vertices (world)
+    uint32_t id;          // axis*2 + (negative side)
 };
 
+// A clip-polygon vertex: its feature id within the face pair, and the line its incoming edge lies
+// on (0..3 = incident-face edge ending at incident corner k, 4..7 = reference side plane s).
+// Ids: incident corner k → k; incident edge k × side s → 4 + 4k + s; side s1 × side s2 (a
+// reference-face corner) → 20 + 4·min + max.
+struct ClipVertex {
+    Vec3     p;
+    uint32_t id;
+    uint32_t line;
+};
+
+uint32_t crossingId(uint32_t line, uint32_t side) {
+    if (line < 4) return 4 + 4 * line + side;
+    const uint32_t s1 = line - 4;
+    return 20 + 4 * std::min(s1, side) + std::max(s1, side);
+}
+
 // The face of a box whose outward normal is most aligned with `dir`.
 Face bestFace(const Vec3& c, const Mat3& R, const Vec3& h, const Vec3& dir) {
     int axis = 0; Real sign = 1; Real best = -1e30f;
@@ -34,6 +53,7 @@ Face bestFace(const Vec3& c, const Mat3& R, const Vec3& h, const Vec3& dir) {
         }
     const int i = (axis + 1) % 3, j = (axis + 2) % 3;
     Face f;
+    f.id = static_cast<uint32_t>(axis * 2 + (sign < 0 ? 1 : 0));
     f.normal = R[axis] * sign;
     f.center = c + f.normal * h[axis];
     f.u = R[i]; f.hu = h[i];
@@ -87,21 +107,23 @@ bool satBoxBox(const Vec3& ca, const Mat3& Ra, const Vec3& ha,
     return true;
 }
 
-// Sutherland-Hodgman: keep the part of `poly` on the inside half-space dot(n,p) <= offset.
-void clip(std::vector<Vec3>& poly, const Vec3& n, Real offset) {
-    std::vector<Vec3> out;
+// Sutherland-Hodgman: keep the part of `poly` on the inside half-space dot(n,p) <= offset, where
+// the plane is reference side `side`. New vertices get crossing ids, so ids survive clipping.
+void clip(std::vector<ClipVertex>& poly, const Vec3& n, Real offset, uint32_t side) {
+    std::vector<ClipVertex> out;
     const size_t m = poly.size();
     for (size_t k = 0; k < m; ++k) {
-        const Vec3& cur = poly[k];
-        const Vec3& prev = poly[(k + m - 1) % m];
-        const Real dc = glm::dot(n, cur) - offset;
-        const Real dp = glm::dot(n, prev) - offset;
+        const ClipVertex& cur = poly[k];
+        const ClipVertex& prev = poly[(k + m - 1) % m];
+        const Real dc = glm::dot(n, cur.p) - offset;
+        const Real dp = glm::dot(n, prev.p) - offset;
         const bool curIn = dc <= 0, prevIn = dp <= 0;
+        const Vec3 x = prev.p + (cur.p - prev.p) * (dp / (dp - dc));
         if (curIn) {
-            if (!prevIn) out.push_back(prev + (cur - prev) * (dp / (dp - dc)));
+            if (!prevIn) out.push_back({ x, crossingId(cur.line, side), 4 + side });   // entering along the plane
             out.push_back(cur);
         } else if (prevIn) {
-            out.push_back(prev + (cur - prev) * (dp / (dp - dc)));
+            out.push_back({ x, crossingId(cur.line, side), cur.line });
         }
     }
     poly.swap(out);
@@ -136,23 +158,26 @@ int boxVsBox(const Vec3& ca, const Quat& qa, const Box& a,
                             : bestFace(ca, Ra, a.halfExtents, -ref.normal);
 
     // Clip the incident face polygon against the reference face's 4 side planes.
-    std::vector<Vec3> poly{ inc.v[0], inc.v[1], inc.v[2], inc.v[3] };
-    clip(poly,  ref.u, glm::dot(ref.u, ref.center) + ref.hu);
-    clip(poly, -ref.u, glm::dot(-ref.u, ref.center) + ref.hu);
-    clip(poly,  ref.w, glm::dot(ref.w, ref.center) + ref.hw);
-    clip(poly, -ref.w, glm::dot(-ref.w, ref.center) + ref.hw);
+    std::vector<ClipVertex> poly{ { inc.v[0], 0, 0 }, { inc.v[1], 1, 1 }, { inc.v[2], 2, 2 }, { inc.v[3], 3, 3 } };
+    clip(poly,  ref.u, glm::dot(ref.u, ref.center) + ref.hu, 0);
+    clip(poly, -ref.u, glm::dot(-ref.u, ref.center) + ref.hu, 1);
+    clip(poly,  ref.w, glm::dot(ref.w, ref.center) + ref.hw, 2);
+    clip(poly, -ref.w, glm::dot(-ref.w, ref.center) + ref.hw, 3);
 
     // Keep points below the reference face; contact separation = signed distance below it.
+    // Feature = (reference box, reference face, incident face, clip id).
+    const uint32_t pairId = 0x8000u | (refIsA ? 0u : 0x1000u) | (ref.id << 9) | (inc.id << 6);
     Contact cand[16];
     int n0 = 0;
     const Real refOffset = glm::dot(ref.normal, ref.center);
-    for (const Vec3& p : poly) {
-        const Real sep = glm::dot(ref.normal, p) - refOffset;
+    for (const ClipVertex& v : poly) {
+        const Real sep = glm::dot(ref.normal, v.p) - refOffset;
         if (sep <= 0 && n0 < 16) {
             cand[n0].normal = n;                 // A -> B
-            cand[n0].point = p;
+            cand[n0].point = v.p;
             cand[n0].separation = sep;
             cand[n0].touching = true;
+            cand[n0].feature = pairId | v.id;
             ++n0;
         }
     }
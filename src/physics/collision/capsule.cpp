@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 #include "engine/physics/collision/gjk_distance.h"
 
@@ -78,13 +79,15 @@ int capsuleVsPlane(const Vec3& capCenter, const Quat& capOrient, const Capsule&
     Vec3 ends[2];
     capsuleSegment(capCenter, capOrient, cap, ends[0], ends[1]);
     int n = 0;
-    for (const Vec3& e : ends) {
+    for (uint32_t k = 0; k < 2; ++k) {
+        const Vec3& e = ends[k];
         const Real sep = glm::dot(plane.normal, e) - plane.offset - cap.radius;
         if (sep <= margin) {
             out[n].normal = plane.normal;                    // plane -> capsule
             out[n].point = e - plane.normal * cap.radius;    // point on the capsule surface
             out[n].separation = sep;
             out[n].touching = true;
+            out[n].feature = 0x8000u | k;                    // the endpoint
             ++n;
         }
     }
@@ -98,7 +101,8 @@ int capsuleVsConvex(const Vec3& capCenter, const Quat& capOrient, const Capsule&
 
     // Per-endpoint closest point to the convex → up to 2 contacts (stable when lying on a face).
     int cnt = 0;
-    for (const Vec3& e : { a, b }) {
+    for (uint32_t k = 0; k < 2; ++k) {
+        const Vec3& e = k == 0 ? a : b;
         const SupportShape point = SupportShape::sphere(e, 0);
         Vec3 we, wc;
         const Real d = gjkClosest(point, convex, we, wc);
@@ -107,6 +111,7 @@ int capsuleVsConvex(const Vec3& capCenter, const Quat& capOrient, const Capsule&
             out[cnt].point = wc;
             out[cnt].separation = d - cap.radius;
             out[cnt].touching = true;
+            out[cnt].feature = 0x8000u | k;                  // the endpoint
             ++cnt;
         }
     }
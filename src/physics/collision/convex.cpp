@@ -10,9 +10,9 @@
 
 namespace engine::physics::collide {
 
-bool convexVsConvex(const SupportShape& a, const SupportShape& b, Contact& out) {
+bool convexVsConvex(const SupportShape& a, const SupportShape& b, Contact& out, Vec3* separatingAxis) {
     Simplex simplex;
-    if (!gjkIntersect(a, b, simplex)) return false;
+    if (!gjkIntersect(a, b, simplex, separatingAxis)) return false;
 
     const EpaResult r = epaPenetration(a, b, simplex);
     if (!r.ok) return false;
@@ -7,71 +7,201 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 namespace engine::physics::collide {
 namespace {
 
+// A face/clip-polygon vertex: its feature id, and the line its incoming edge lies on. Ids and
+// lines are built from hull vertex indices, so they are independent of polygon order:
+//   vertex v                                  → id v,  line v (incident edge ending at v)
+//   reference side plane from vertex r        → line 0x8000 | r
+//   incident edge line × side plane           → 0x80000000 | line << 16 | r
+//   side plane × side plane (reference corner) → 0xC0000000 | min(r) << 15 | max(r)
+struct ClipVertex {
+    Vec3     p;
+    uint32_t id;
+    uint32_t line;
+};
+
+uint32_t crossingId(uint32_t line, uint32_t side) {
+    if (line < 0x8000u) return 0x80000000u | (line << 16) | (side & 0x7FFFu);
+    const uint32_t r0 = line & 0x7FFFu, r1 = side & 0x7FFFu;
+    return 0xC0000000u | (std::min(r0, r1) << 15) | std::max(r0, r1);
+}
+
+inline uint32_t mix(uint32_t h) {   // murmur3 finalizer
+    h ^= h >> 16; h *= 0x85ebca6bu;
+    h ^= h >> 13; h *= 0xc2b2ae35u;
+    return h ^ (h >> 16);
+}
+
 // Vertices whose projection onto `dir` is within `tol` of the maximum — the supporting feature.
-std::vector<Vec3> extractFace(std::span<const Vec3> verts, const Vec3& dir, Real tol) {
+std::vector<ClipVertex> extractFace(std::span<const Vec3> verts, const Vec3& dir, Real tol) {
     Real mx = -1e30f;
     for (const Vec3& v : verts) mx = std::max(mx, glm::dot(v, dir));
-    std::vector<Vec3> poly;
-    for (const Vec3& v : verts)
-        if (glm::dot(v, dir) >= mx - tol) poly.push_back(v);
+    std::vector<ClipVertex> poly;
+    for (size_t i = 0; i < verts.size(); ++i)
+        if (glm::dot(verts[i], dir) >= mx - tol) {
+            const uint32_t id = static_cast<uint32_t>(i) & 0x7FFFu;
+            poly.push_back({ verts[i], id, id });
+        }
     return poly;
 }
 
-Vec3 centroid(const std::vector<Vec3>& poly) {
+Vec3 centroid(const std::vector<ClipVertex>& poly) {
     Vec3 c(0);
-    for (const Vec3& p : poly) c += p;
+    for (const ClipVertex& v : poly) c += v.p;
     return poly.empty() ? c : c / static_cast<Real>(poly.size());
 }
 
 // Order polygon vertices CCW around `axis` (so consecutive vertices form edges).
-void orderPolygon(std::vector<Vec3>& poly, const Vec3& axis) {
+void orderPolygon(std::vector<ClipVertex>& poly, const Vec3& axis) {
     if (poly.size() < 3) return;
     const Vec3 c = centroid(poly);
-    Vec3 u = poly[0] - c;
+    Vec3 u = poly[0].p - c;
     u -= axis * glm::dot(u, axis);
     if (glm::dot(u, u) < kEpsilon) return;
     u = glm::normalize(u);
     const Vec3 w = glm::cross(axis, u);
-    std::sort(poly.begin(), poly.end(), [&](const Vec3& p, const Vec3& q) {
-        const Vec3 pp = p - c, qq = q - c;
+    std::sort(poly.begin(), poly.end(), [&](const ClipVertex& p, const ClipVertex& q) {
+        const Vec3 pp = p.p - c, qq = q.p - c;
         return std::atan2(glm::dot(pp, w), glm::dot(pp, u)) <
                std::atan2(glm::dot(qq, w), glm::dot(qq, u));
     });
 }
 
-// Sutherland-Hodgman: keep the part of `poly` with dot(n,p) <= offset.
-void clip(std::vector<Vec3>& poly, const Vec3& n, Real offset) {
-    std::vector<Vec3> out;
+// Sutherland-Hodgman: keep the part of `poly` with dot(n,p) <= offset; `side` is the plane's line.
+void clip(std::vector<ClipVertex>& poly, const Vec3& n, Real offset, uint32_t side) {
+    thread_local std::vector<ClipVertex> out;
+    out.clear();
     const size_t m = poly.size();
     for (size_t k = 0; k < m; ++k) {
-        const Vec3& cur = poly[k];
-        const Vec3& prev = poly[(k + m - 1) % m];
-        const Real dc = glm::dot(n, cur) - offset;
-        const Real dp = glm::dot(n, prev) - offset;
+        const ClipVertex& cur = poly[k];
+        const ClipVertex& prev = poly[(k + m - 1) % m];
+        const Real dc = glm::dot(n, cur.p) - offset;
+        const Real dp = glm::dot(n, prev.p) - offset;
+        const Vec3 x = prev.p + (cur.p - prev.p) * (dp / (dp - dc));
         if (dc <= 0) {
-            if (dp > 0) out.push_back(prev + (cur - prev) * (dp / (dp - dc)));
+            if (dp > 0) out.push_back({ x, crossingId(cur.line, side), side });
             out.push_back(cur);
         } else if (dp <= 0) {
-            out.push_back(prev + (cur - prev) * (dp / (dp - dc)));
+            out.push_back({ x, crossingId(cur.line, side), cur.line });
         }
     }
     poly.swap(out);
 }
 
+// Keeps the incident points on or below the reference plane (refN · p <= refOff), at most the 4
+// deepest; each feature is its clip id hashed with the face pair into 15 bits.
+int keepPenetrating(const std::vector<ClipVertex>& incPoly, const Vec3& n, const Vec3& refN, Real refOff,
+                    uint32_t facePair, const Contact& epa, Contact out[4]) {
+    Contact cand[32];
+    int cnt = 0;
+    for (const ClipVertex& v : incPoly) {
+        const Real sep = glm::dot(refN, v.p) - refOff;
+        if (sep <= 0 && cnt < 32) {
+            cand[cnt].normal = n;                  // always A -> B
+            cand[cnt].point = v.p;
+            cand[cnt].separation = sep;
+            cand[cnt].touching = true;
+            cand[cnt].feature = 0x8000u | (mix(v.id * 0x9E3779B1u ^ facePair) & 0x7FFFu);
+            ++cnt;
+        }
+    }
+    if (cnt == 0) { out[0] = epa; return 1; }
+
+    const int keep = std::min(cnt, 4);
+    for (int i = 0; i < keep; ++i) {
+        int bi = i;
+        for (int j = i + 1; j < cnt; ++j)
+            if (cand[j].separation < cand[bi].separation) bi = j;
+        std::swap(cand[i], cand[bi]);
+        out[i] = cand[i];
+    }
+    return keep;
+}
+
+// ---- cooked polytopes ----
+
+// Below this cosine between the EPA normal and the best face normal of either shape, the contact
+// is taken as edge-edge / vertex: a single EPA point.
+constexpr Real kFaceAlign = Real(0.98);
+
+Vec3 worldNormal(const PolytopeView& p, int face) {
+    return p.orient * glm::normalize(p.hull->faces[face].normal / p.scale);   // inverse-transpose of the scale
+}
+
+// The face of `p` whose world normal is closest to `dir`; `align` receives that cosine.
+int bestFace(const PolytopeView& p, const Vec3& dir, Real& align) {
+    const Vec3 d = glm::conjugate(p.orient) * dir;
+    int best = 0;
+    align = Real(-2);
+    for (size_t f = 0; f < p.hull->faces.size(); ++f) {
+        const Vec3 nl = p.hull->faces[f].normal / p.scale;
+        const Real c = glm::dot(nl, d) / glm::length(nl);
+        if (c > align) { align = c; best = static_cast<int>(f); }
+    }
+    return best;
+}
+
+// A face's loop in world space (counter-clockwise about its outward normal).
+void faceLoop(const PolytopeView& p, int face, std::vector<ClipVertex>& poly) {
+    poly.clear();
+    const CookedHull& h = *p.hull;
+    const uint16_t first = h.faces[face].edge;
+    uint16_t e = first;
+    do {
+        const uint32_t v = h.edges[e].origin;
+        poly.push_back({ p.center + p.orient * (p.scale * h.vertices[v]), v & 0x7FFFu, v & 0x7FFFu });
+        e = h.edges[e].next;
+    } while (e != first);
+}
+
 } // namespace
 
+int polytopeManifold(const PolytopeView& a, const PolytopeView& b, const Contact& epa, Contact out[4]) {
+    const Vec3 n = epa.normal;         // A -> B
+    Real alignA, alignB;
+    const int fa = bestFace(a, n, alignA);    // A's face toward B
+    const int fb = bestFace(b, -n, alignB);   // B's face toward A
+    if (std::max(alignA, alignB) < kFaceAlign) { out[0] = epa; return 1; }
+
+    const bool refA = alignA + Real(1e-3) >= alignB;   // slight preference keeps the choice stable
+    const PolytopeView& ref = refA ? a : b;
+    const PolytopeView& inc = refA ? b : a;
+    const int refFace = refA ? fa : fb;
+    const Vec3 refN = worldNormal(ref, refFace);
+    Real incAlign;
+    const int incFace = bestFace(inc, -refN, incAlign);   // most anti-parallel to the reference
+
+    thread_local std::vector<ClipVertex> refPoly, incPoly;
+    faceLoop(ref, refFace, refPoly);
+    faceLoop(inc, incFace, incPoly);
+    const uint32_t facePair = mix((refA ? 0x80000000u : 0u) | (static_cast<uint32_t>(refFace) << 15)
+                                  | static_cast<uint32_t>(incFace));
+
+    // Clip the incident face against the reference face's side planes (outward: edge × normal).
+    const size_t m = refPoly.size();
+    for (size_t k = 0; k < m && !incPoly.empty(); ++k) {
+        const Vec3 e0 = refPoly[k].p, e1 = refPoly[(k + 1) % m].p;
+        Vec3 sideN = glm::cross(e1 - e0, refN);
+        if (glm::dot(sideN, sideN) < kEpsilon) continue;
+        sideN = glm::normalize(sideN);
+        clip(incPoly, sideN, glm::dot(sideN, e0), 0x8000u | refPoly[k].id);
+    }
+    if (incPoly.empty()) { out[0] = epa; return 1; }
+    return keepPenetrating(incPoly, n, refN, glm::dot(refN, refPoly[0].p), facePair, epa, out);
+}
+
 int polytopeManifold(std::span<const Vec3> vertsA, std::span<const Vec3> vertsB,
                      const Contact& epa, Contact out[4]) {
     const Vec3 n = epa.normal;         // A -> B
     const Real tol = Real(0.02);
 
-    std::vector<Vec3> Pa = extractFace(vertsA, n, tol);    // A's face toward B
-    std::vector<Vec3> Pb = extractFace(vertsB, -n, tol);   // B's face toward A
+    std::vector<ClipVertex> Pa = extractFace(vertsA, n, tol);    // A's face toward B
+    std::vector<ClipVertex> Pb = extractFace(vertsB, -n, tol);   // B's face toward A
 
     bool refA;
     if (Pa.size() >= 3 && Pa.size() >= Pb.size()) refA = true;
@@ -79,10 +209,13 @@ int polytopeManifold(std::span<const Vec3> vertsA, std::span<const Vec3> vertsB,
     else { out[0] = epa; return 1; }               // edge/vertex contact → single point
 
     const Vec3 refN = refA ? n : -n;
-    std::vector<Vec3>& refPoly = refA ? Pa : Pb;
-    std::vector<Vec3>& incPoly = refA ? Pb : Pa;
+    std::vector<ClipVertex>& refPoly = refA ? Pa : Pb;
+    std::vector<ClipVertex>& incPoly = refA ? Pb : Pa;
     if (incPoly.empty()) { out[0] = epa; return 1; }
 
+    // The face pair, keyed by each face's lowest vertex index (extractFace lists them ascending).
+    const uint32_t facePair = mix((refA ? 0x80000000u : 0u) | (refPoly[0].id << 15) | incPoly[0].id);
+
     orderPolygon(refPoly, refN);
     orderPolygon(incPoly, refN);
 
@@ -90,41 +223,19 @@ int polytopeManifold(std::span<const Vec3> vertsA, std::span<const Vec3> vertsB,
     const Vec3 rc = centroid(refPoly);
     const size_t m = refPoly.size();
     for (size_t k = 0; k < m && !incPoly.empty(); ++k) {
-        const Vec3 e0 = refPoly[k], e1 = refPoly[(k + 1) % m];
+        const Vec3 e0 = refPoly[k].p, e1 = refPoly[(k + 1) % m].p;
         Vec3 sideN = glm::cross(e1 - e0, refN);
         if (glm::dot(sideN, sideN) < kEpsilon) continue;
         sideN = glm::normalize(sideN);
         Real off = glm::dot(sideN, e0);
         if (glm::dot(sideN, rc) > off) { sideN = -sideN; off = glm::dot(sideN, e0); }   // inside = centroid side
-        clip(incPoly, sideN, off);
+        clip(incPoly, sideN, off, 0x8000u | refPoly[k].id);
     }
     if (incPoly.empty()) { out[0] = epa; return 1; }
 
     // Keep points penetrating the reference face plane; separation = signed distance below it.
-    const Real refOff = glm::dot(refN, refPoly.empty() ? epa.point : refPoly[0]);
-    Contact cand[32];
-    int cnt = 0;
-    for (const Vec3& p : incPoly) {
-        const Real sep = glm::dot(refN, p) - refOff;
-        if (sep <= 0 && cnt < 32) {
-            cand[cnt].normal = n;                  // always A -> B
-            cand[cnt].point = p;
-            cand[cnt].separation = sep;
-            cand[cnt].touching = true;
-            ++cnt;
-        }
-    }
-    if (cnt == 0) { out[0] = epa; return 1; }
-
-    const int keep = std::min(cnt, 4);
-    for (int i = 0; i < keep; ++i) {
-        int bi = i;
-        for (int j = i + 1; j < cnt; ++j)
-            if (cand[j].separation < cand[bi].separation) bi = j;
-        std::swap(cand[i], cand[bi]);
-        out[i] = cand[i];
-    }
-    return keep;
+    const Real refOff = glm::dot(refN, refPoly.empty() ? epa.point : refPoly[0].p);
+    return keepPenetrating(incPoly, n, refN, refOff, facePair, epa, out);
 }
 
 } // namespace engine::physics::collide
@@ -15,17 +15,20 @@ namespace {
 
 struct Face {
     int  a, b, c;
-    Vec3 normal;   // outward (points away from origin, which is inside the polytope)
-    Real dist;     // distance from origin to the face plane
+    Vec3 normal;   // outward (away from the polytope's interior)
+    Real dist;     // signed distance from origin to the face plane
 };
 
-Face makeFace(const std::vector<Vec3>& v, int a, int b, int c) {
+// Oriented away from `inside`, a point strictly inside the polytope (the first tetrahedron's
+// centroid — the polytope only grows). Not away from the origin: for touching shapes the origin
+// lies on the Minkowski surface, and a face through it would get an arbitrary side (a box resting
+// on a flat hull top then expanded downward into a bogus deep contact).
+Face makeFace(const std::vector<Vec3>& v, int a, int b, int c, const Vec3& inside) {
     Vec3 n = glm::cross(v[b] - v[a], v[c] - v[a]);
     const Real len = glm::length(n);
     n = (len > kEpsilon) ? n / len : Vec3(0, 1, 0);
-    Real d = glm::dot(n, v[a]);
-    if (d < 0) { n = -n; d = -d; std::swap(b, c); }   // orient outward (origin inside)
-    return Face{ a, b, c, n, d };
+    if (glm::dot(n, v[a] - inside) < 0) { n = -n; std::swap(b, c); }
+    return Face{ a, b, c, n, glm::dot(n, v[a]) };
 }
 
 // Add an edge to the silhouette list, cancelling it if the reverse edge is already present
@@ -83,9 +86,10 @@ EpaResult epaPenetration(const SupportShape& a, const SupportShape& b, const Sim
     Vec3 t[4];
     if (!buildTetra(a, b, t)) return {};
     std::vector<Vec3> verts{ t[0], t[1], t[2], t[3] };
+    const Vec3 inside = (t[0] + t[1] + t[2] + t[3]) * Real(0.25);
     std::vector<Face> faces{
-        makeFace(verts, 0, 1, 2), makeFace(verts, 0, 1, 3),
-        makeFace(verts, 0, 2, 3), makeFace(verts, 1, 2, 3),
+        makeFace(verts, 0, 1, 2, inside), makeFace(verts, 0, 1, 3, inside),
+        makeFace(verts, 0, 2, 3, inside), makeFace(verts, 1, 2, 3, inside),
     };
 
     for (int iter = 0; iter < 64; ++iter) {
@@ -125,7 +129,7 @@ EpaResult epaPenetration(const SupportShape& a, const SupportShape& b, const Sim
                 ++i;
             }
         }
-        for (const auto& [e0, e1] : edges) faces.push_back(makeFace(verts, e0, e1, vi));
+        for (const auto& [e0, e1] : edges) faces.push_back(makeFace(verts, e0, e1, vi, inside));
         if (faces.empty()) return {};
     }
 
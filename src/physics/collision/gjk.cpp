@@ -77,7 +77,7 @@ bool nextSimplex(Simplex& s, Vec3& dir) {
 
 } // namespace
 
-bool gjkIntersect(const SupportShape& a, const SupportShape& b, Simplex& out) {
+bool gjkIntersect(const SupportShape& a, const SupportShape& b, Simplex& out, Vec3* separatingAxis) {
     Vec3 dir = b.center - a.center;
     if (glm::dot(dir, dir) < kEpsilon) dir = Vec3(1, 0, 0);
 
@@ -88,11 +88,15 @@ bool gjkIntersect(const SupportShape& a, const SupportShape& b, Simplex& out) {
     for (int iter = 0; iter < 64; ++iter) {
         if (glm::dot(dir, dir) < kEpsilon) dir = Vec3(1, 0, 0);
         const Vec3 p = minkowskiSupport(a, b, dir);
-        if (glm::dot(p, dir) < 0) return false;      // no overlap along the search direction
+        if (glm::dot(p, dir) < 0) {                  // no overlap along the search direction
+            if (separatingAxis) *separatingAxis = dir;
+            return false;
+        }
         s.push(p);
-        if (nextSimplex(s, dir)) { out = s; return true; }
+        if (nextSimplex(s, dir)) break;
     }
     out = s;
+    if (separatingAxis) *separatingAxis = Vec3(0);
     return true;
 }
 
@@ -7,10 +7,27 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include <glm/gtc/quaternion.hpp>
 
 namespace engine::physics::collide {
+namespace {
+
+// Moves the (up to) 4 deepest of the n candidates, in order, into out.
+int keepDeepest(Contact* cand, int n, Contact out[4]) {
+    const int keep = std::min(n, 4);
+    for (int i = 0; i < keep; ++i) {
+        int best = i;
+        for (int j = i + 1; j < n; ++j)
+            if (cand[j].separation < cand[best].separation) best = j;
+        std::swap(cand[i], cand[best]);
+        out[i] = cand[i];
+    }
+    return keep;
+}
+
+} // namespace
 
 bool sphereVsPlane(const Vec3& center, const Sphere& sphere,
                    const Plane& plane, Real margin, Contact& out) {
@@ -73,18 +90,54 @@ int pointsVsPlane(const Vec3* worldPoints, int count, const Plane& plane, Real m
             cand[n].point = worldPoints[i];
             cand[n].separation = sep;
             cand[n].touching = true;
+            cand[n].feature = 0x8000u | static_cast<uint32_t>(i);   // the point's index
             ++n;
         }
     }
-    const int keep = std::min(n, 4);
-    for (int i = 0; i < keep; ++i) {
-        int best = i;
-        for (int j = i + 1; j < n; ++j)
-            if (cand[j].separation < cand[best].separation) best = j;
-        std::swap(cand[i], cand[best]);
-        out[i] = cand[i];
+    return keepDeepest(cand, n, out);
+}
+
+int hullVsPlane(const Vec3& center, const Quat& orient, const CookedHull& hull,
+                const Plane& plane, Real margin, Contact out[4]) {
+    // The vertices within the margin are a connected patch of the vertex graph around the deepest
+    // one (every vertex has a descending path to the minimum), so the fill finds all of them. The
+    // patch can hold every vertex; only the first 64 in COOKED vertex order are kept (the same as
+    // pointsVsPlane over the cooked vertices — not over the raw cloud, which cooking prunes and
+    // renumbers). Visits are marked with a per-call epoch, so the fill is linear in the patch.
+    auto sep = [&](int v) { return glm::dot(plane.normal, center + orient * hull.vertices[v]) - plane.offset; };
+    thread_local std::vector<int> patch;
+    thread_local std::vector<uint32_t> seen;   // vertex → epoch of the last fill that reached it
+    thread_local uint32_t epoch = 0;
+    if (seen.size() < hull.vertices.size()) seen.resize(hull.vertices.size(), epoch);
+    if (++epoch == 0) { std::fill(seen.begin(), seen.end(), 0u); epoch = 1; }   // wrapped
+    patch.clear();
+    const int deepest = hull.support(glm::conjugate(orient) * -plane.normal);
+    if (!(sep(deepest) <= margin)) return 0;
+    patch.push_back(deepest);
+    seen[deepest] = epoch;
+    for (size_t k = 0; k < patch.size(); ++k) {
+        const uint32_t first = hull.vertexEdge[patch[k]];
+        uint32_t e = first;
+        do {
+            const int u = hull.edges[hull.edges[e].twin].origin;
+            if (seen[u] != epoch) {
+                seen[u] = epoch;   // tested once per fill, in or out
+                if (sep(u) <= margin) patch.push_back(u);
+            }
+            e = hull.edges[hull.edges[e].twin].next;
+        } while (e != first);
     }
-    return keep;
+    std::sort(patch.begin(), patch.end());   // cooked vertex order, as feature ids 0x8000 | index
+    const int n = static_cast<int>(std::min<size_t>(patch.size(), 64));
+    Contact cand[64];
+    for (int i = 0; i < n; ++i) {
+        cand[i].normal = plane.normal;   // plane -> shape
+        cand[i].point = center + orient * hull.vertices[patch[i]];
+        cand[i].separation = glm::dot(plane.normal, cand[i].point) - plane.offset;
+        cand[i].touching = true;
+        cand[i].feature = 0x8000u | static_cast<uint32_t>(patch[i]);
+    }
+    return keepDeepest(cand, n, out);
 }
 
 int boxVsPlane(const Vec3& boxCenter, const Quat& boxOrient, const Box& box,
@@ -0,0 +1,260 @@
+//
+//  cooked_hull.cpp
+//  engine::physics / shapes
+//
+
+#include "engine/physics/shapes/cooked_hull.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::physics {
+namespace {
+
+struct Tri {
+    int  v[3];
+    Vec3 n;
+    Real d;
+    bool alive;
+};
+
+Tri makeTri(std::span<const Vec3> p, int a, int b, int c) {
+    Vec3 n = glm::cross(p[b] - p[a], p[c] - p[a]);
+    const Real len = glm::length(n);
+    n = len > Real(0) ? n / len : Vec3(0);
+    return Tri{ { a, b, c }, n, glm::dot(n, p[a]), true };
+}
+
+Real distToLine(const Vec3& x, const Vec3& a, const Vec3& b) {
+    return glm::length(glm::cross(x - a, glm::normalize(b - a)));
+}
+
+// Incremental hull over triangles: each point outside the current hull (beyond `tol`) replaces
+// the faces it sees with a fan from the horizon. Points within `tol` of the hull are dropped.
+bool triangulatedHull(std::span<const Vec3> p, Real tol, std::vector<Tri>& tris) {
+    const int n = static_cast<int>(p.size());
+    int i0 = 0;
+    for (int i = 1; i < n; ++i) if (p[i].x < p[i0].x) i0 = i;
+    int i1 = i0;
+    for (int i = 0; i < n; ++i) if (glm::length(p[i] - p[i0]) > glm::length(p[i1] - p[i0])) i1 = i;
+    if (glm::length(p[i1] - p[i0]) <= tol) return false;
+    int i2 = i0;
+    Real best = 0;
+    for (int i = 0; i < n; ++i)
+        if (const Real d = distToLine(p[i], p[i0], p[i1]); d > best) { best = d; i2 = i; }
+    if (best <= tol) return false;
+    const Tri base = makeTri(p, i0, i1, i2);
+    int i3 = i0;
+    best = 0;
+    for (int i = 0; i < n; ++i)
+        if (const Real d = std::abs(glm::dot(base.n, p[i]) - base.d); d > best) { best = d; i3 = i; }
+    if (best <= tol) return false;
+
+    const Vec3 inside = (p[i0] + p[i1] + p[i2] + p[i3]) * Real(0.25);
+    tris.clear();
+    const int seed[4][3] = { { i0, i1, i2 }, { i0, i3, i1 }, { i1, i3, i2 }, { i2, i3, i0 } };
+    for (const auto& s : seed) {
+        Tri t = makeTri(p, s[0], s[1], s[2]);
+        if (glm::dot(t.n, inside) > t.d) t = makeTri(p, s[0], s[2], s[1]);   // face outward
+        tris.push_back(t);
+    }
+
+    std::vector<std::pair<int, int>> visibleEdges, horizon;
+    for (int i = 0; i < n; ++i) {
+        if (i == i0 || i == i1 || i == i2 || i == i3) continue;
+        visibleEdges.clear();
+        for (Tri& t : tris) {
+            if (!t.alive || glm::dot(t.n, p[i]) - t.d <= tol) continue;
+            t.alive = false;
+            for (int k = 0; k < 3; ++k) visibleEdges.emplace_back(t.v[k], t.v[(k + 1) % 3]);
+        }
+        if (visibleEdges.empty()) continue;   // inside (or on) the hull
+        horizon.clear();
+        for (const auto& [a, b] : visibleEdges)
+            if (std::find(visibleEdges.begin(), visibleEdges.end(), std::make_pair(b, a)) == visibleEdges.end())
+                horizon.emplace_back(a, b);
+        for (const auto& [a, b] : horizon) tris.push_back(makeTri(p, a, b, i));
+        std::erase_if(tris, [](const Tri& t) { return !t.alive; });
+    }
+    return true;
+}
+
+// Groups coplanar neighbouring triangles into faces and returns each face's boundary loop
+// (counter-clockwise about the outward normal), with collinear loop vertices removed.
+bool mergeFaces(std::span<const Vec3> p, Real tol, const std::vector<Tri>& tris,
+                std::vector<std::vector<int>>& loops) {
+    const size_t nt = tris.size();
+    std::unordered_map<uint64_t, int> edgeTri;   // directed edge (a, b) → triangle
+    auto key = [](int a, int b) { return (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b); };
+    for (size_t t = 0; t < nt; ++t)
+        for (int k = 0; k < 3; ++k) edgeTri[key(tris[t].v[k], tris[t].v[(k + 1) % 3])] = static_cast<int>(t);
+
+    std::vector<int> cluster(nt, -1), stack;
+    loops.clear();
+    for (size_t seed = 0; seed < nt; ++seed) {
+        if (cluster[seed] >= 0) continue;
+        const int id = static_cast<int>(loops.size());
+        const Tri& s = tris[seed];
+        cluster[seed] = id;
+        stack.assign(1, static_cast<int>(seed));
+        std::vector<std::pair<int, int>> boundary;
+        while (!stack.empty()) {
+            const Tri& t = tris[stack.back()];
+            stack.pop_back();
+            for (int k = 0; k < 3; ++k) {
+                const int a = t.v[k], b = t.v[(k + 1) % 3];
+                const auto it = edgeTri.find(key(b, a));
+                if (it == edgeTri.end()) return false;   // open mesh
+                const int u = it->second;
+                const Tri& o = tris[u];
+                bool coplanar = cluster[u] < 0 || cluster[u] == id;
+                for (int m = 0; m < 3 && coplanar; ++m)
+                    coplanar = std::abs(glm::dot(s.n, p[o.v[m]]) - s.d) <= tol;
+                if (coplanar && cluster[u] < 0) { cluster[u] = id; stack.push_back(u); }
+                if (!coplanar || cluster[u] != id) boundary.emplace_back(a, b);
+            }
+        }
+        // Chain the boundary edges into one loop.
+        std::vector<int> loop;
+        int v = boundary[0].first;
+        for (size_t step = 0; step < boundary.size(); ++step) {
+            loop.push_back(v);
+            const auto it = std::find_if(boundary.begin(), boundary.end(),
+                                         [&](const auto& e) { return e.first == v; });
+            if (it == boundary.end()) return false;
+            v = it->second;
+        }
+        if (v != loop[0]) return false;   // not a single simple loop
+        for (bool removed = true; removed && loop.size() > 3;) {   // drop mid-edge vertices
+            removed = false;
+            for (size_t k = 0; k < loop.size(); ++k) {
+                const Vec3& a = p[loop[(k + loop.size() - 1) % loop.size()]];
+                const Vec3& c = p[loop[(k + 1) % loop.size()]];
+                if (distToLine(p[loop[k]], a, c) <= tol) {
+                    loop.erase(loop.begin() + static_cast<std::ptrdiff_t>(k));
+                    removed = true;
+                    break;
+                }
+            }
+        }
+        loops.push_back(std::move(loop));
+    }
+    return true;
+}
+
+// Solid volume, centroid and unit-mass central inertia from the face loops (fan tetrahedra
+// against an interior reference point; second moments per Tonon 2004).
+void massProperties(CookedHull& h) {
+    Vec3 r(0);
+    for (const Vec3& v : h.vertices) r += v;
+    r /= static_cast<Real>(h.vertices.size());
+    double vol = 0, g[3] = {}, c[3][3] = {};
+    for (const CookedHull::Face& f : h.faces) {
+        const uint16_t e0 = f.edge;
+        const Vec3 a = h.vertices[h.edges[e0].origin] - r;
+        for (uint16_t e = h.edges[e0].next; h.edges[e].next != e0; e = h.edges[e].next) {
+            const Vec3 b = h.vertices[h.edges[e].origin] - r;
+            const Vec3 d = h.vertices[h.edges[h.edges[e].next].origin] - r;
+            const double det = glm::dot(a, glm::cross(b, d));
+            const Vec3 s = a + b + d;
+            vol += det / 6.0;
+            for (int i = 0; i < 3; ++i) {
+                g[i] += det / 24.0 * s[i];
+                for (int j = 0; j < 3; ++j)
+                    c[i][j] += det / 120.0 * (double(s[i]) * s[j] + double(a[i]) * a[j]
+                                              + double(b[i]) * b[j] + double(d[i]) * d[j]);
+            }
+        }
+    }
+    h.volume = static_cast<Real>(vol);
+    for (int i = 0; i < 3; ++i) g[i] /= vol;
+    h.centroid = r + Vec3(static_cast<Real>(g[0]), static_cast<Real>(g[1]), static_cast<Real>(g[2]));
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j) c[i][j] -= vol * g[i] * g[j];   // about the centroid
+    const double tr = c[0][0] + c[1][1] + c[2][2];
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            h.inertia[j][i] = static_cast<Real>(((i == j ? tr : 0.0) - c[i][j]) / vol);
+}
+
+} // namespace
+
+bool cookHull(std::span<const Vec3> points, CookedHull& out) {
+    out = CookedHull{};
+    if (points.size() < 4) return false;
+    Real scale = 0;
+    for (const Vec3& v : points) scale = std::max({ scale, std::abs(v.x), std::abs(v.y), std::abs(v.z) });
+    const Real tol = Real(1e-4) * std::max(scale, Real(1e-3));
+
+    std::vector<Tri> tris;
+    std::vector<std::vector<int>> loops;
+    if (!triangulatedHull(points, tol, tris) || !mergeFaces(points, tol, tris, loops)) return false;
+
+    // Vertices still on some face loop, renumbered in input order.
+    std::vector<int> remap(points.size(), -1);
+    for (const auto& loop : loops)
+        for (int v : loop) remap[v] = 0;
+    CookedHull h;
+    for (size_t i = 0; i < points.size(); ++i)
+        if (remap[i] == 0) { remap[i] = static_cast<int>(h.vertices.size()); h.vertices.push_back(points[i]); }
+
+    size_t edgeCount = 0;
+    for (const auto& loop : loops) edgeCount += loop.size();
+    if (edgeCount > 0xFFFF) return false;
+    std::unordered_map<uint32_t, uint16_t> edgeOf;   // (origin << 16 | dest) → half-edge
+    for (const auto& loop : loops) {
+        CookedHull::Face f;
+        f.edge = static_cast<uint16_t>(h.edges.size());
+        f.count = static_cast<uint16_t>(loop.size());
+        Vec3 newell(0), sum(0);
+        for (size_t k = 0; k < loop.size(); ++k) {
+            const int a = remap[loop[k]], b = remap[loop[(k + 1) % loop.size()]];
+            const Vec3& pa = h.vertices[a];
+            const Vec3& pb = h.vertices[b];
+            newell += Vec3((pa.y - pb.y) * (pa.z + pb.z), (pa.z - pb.z) * (pa.x + pb.x), (pa.x - pb.x) * (pa.y + pb.y));
+            sum += pa;
+            CookedHull::HalfEdge e;
+            e.origin = static_cast<uint16_t>(a);
+            e.next = static_cast<uint16_t>(f.edge + (k + 1) % loop.size());
+            e.face = static_cast<uint16_t>(h.faces.size());
+            edgeOf[(static_cast<uint32_t>(a) << 16) | static_cast<uint32_t>(b)] = static_cast<uint16_t>(h.edges.size());
+            h.edges.push_back(e);
+        }
+        f.normal = glm::normalize(newell);
+        f.offset = glm::dot(f.normal, sum / static_cast<Real>(loop.size()));
+        h.faces.push_back(f);
+    }
+    h.vertexEdge.assign(h.vertices.size(), 0xFFFF);
+    for (size_t e = 0; e < h.edges.size(); ++e) {
+        const uint16_t a = h.edges[e].origin, b = h.edges[h.edges[e].next].origin;
+        const auto it = edgeOf.find((static_cast<uint32_t>(b) << 16) | a);
+        if (it == edgeOf.end()) return false;   // inconsistent merge → not a closed 2-manifold
+        h.edges[e].twin = it->second;
+        if (h.vertexEdge[a] == 0xFFFF) h.vertexEdge[a] = static_cast<uint16_t>(e);
+    }
+    if (h.vertices.size() + h.faces.size() != h.edges.size() / 2 + 2) return false;   // Euler
+
+    massProperties(h);
+    if (!(h.volume > Real(0))) return false;
+    out = std::move(h);
+    return true;
+}
+
+const CookedHull& unitBoxHull() {
+    static const CookedHull box = [] {
+        Vec3 corners[8];
+        int n = 0;
+        for (int sx = -1; sx <= 1; sx += 2)   // collide::boxVsPlane's corner order
+            for (int sy = -1; sy <= 1; sy += 2)
+                for (int sz = -1; sz <= 1; sz += 2) corners[n++] = Vec3(sx, sy, sz);
+        CookedHull h;
+        cookHull(corners, h);
+        return h;
+    }();
+    return box;
+}
+
+} // namespace engine::physics
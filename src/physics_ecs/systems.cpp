@@ -5,6 +5,11 @@
 
 #include "engine/physics_ecs/systems.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 #include "engine/core/math/transform.h"
 #include "engine/ecs/ecs.h"
 #include "engine/physics_ecs/components.h"
@@ -21,14 +26,62 @@ void stepSystem(ecs::World& world) {
 void syncSystem(ecs::World& world) {
     auto* ref = world.getResource<PhysicsWorldRef>();
     if (!ref || !ref->world) return;
-    physics::PhysicsWorld& pw = *ref->world;
+    syncPoses(world, *ref->world);
+}
 
-    world.query<RigidBody, engine::Transform>().each(
-        [&](ecs::Entity, RigidBody& rb, engine::Transform& t) {
-            const engine::Transform p = pw.pose(rb.body);
-            t.position = p.position;
-            t.rotation = p.rotation;   // keep the entity's own scale
-        });
+namespace {
+
+// Rows per parallel task in syncPoses (and the minimum table size worth splitting).
+constexpr size_t kSyncBlockRows = 4096;
+
+} // namespace
+
+void syncPoses(ecs::World& world, const physics::PhysicsWorld& pw, core::ThreadPool* pool) {
+    const std::span<const engine::Transform> poses = pw.poses();
+    const std::span<const uint32_t> generations = pw.bodyGenerations();
+    const uint32_t tick = world.changeTick();
+    const ecs::ComponentMask mask = ecs::componentMask<RigidBody, engine::Transform>();
+    const ecs::ComponentId rbId = ecs::componentId<RigidBody>(), tId = ecs::componentId<engine::Transform>();
+
+    for (ecs::Archetype& a : world.archetypes()) {
+        if (a.count == 0 || !a.hasAll(mask)) continue;
+        // The RigidBody column is the chunk's row -> body-index map; scatter poses() through it.
+        const auto* bodies = static_cast<const RigidBody*>(a.columnPtr(a.columnIndex(rbId), 0));
+        ecs::Column& tcol = a.columns[static_cast<size_t>(a.columnIndex(tId))];
+        auto* ts = reinterpret_cast<engine::Transform*>(tcol.data.data());
+        uint32_t* ticks = tcol.ticks.data();
+
+        // Only bodies that moved are written (and change-stamped), so static/resting bodies stay
+        // "unchanged" for downstream changed<Transform>() consumers (e.g. scene::extract).
+        auto rows = [&](size_t begin, size_t end) {
+            bool any = false;
+            for (size_t r = begin; r < end; ++r) {
+                const uint32_t b = bodies[r].body.index;
+                // Skip stale handles: a destroyed body's slot may already hold another body.
+                if (b >= poses.size() || generations[b] != bodies[r].body.generation) continue;
+                const engine::Transform& p = poses[b];
+                if (p.position == ts[r].position && p.rotation == ts[r].rotation) continue;
+                ts[r].position = p.position;
+                ts[r].rotation = p.rotation;   // keep the entity's own scale
+                ticks[r] = tick;
+                any = true;
+            }
+            return any;
+        };
+
+        bool any = false;
+        if (pool && a.count >= 2 * kSyncBlockRows) {
+            const size_t blocks = (a.count + kSyncBlockRows - 1) / kSyncBlockRows;
+            std::vector<uint8_t> moved(blocks, 0);
+            pool->parallelFor(blocks, [&](size_t k) {
+                moved[k] = rows(k * kSyncBlockRows, std::min<size_t>(a.count, (k + 1) * kSyncBlockRows));
+            }, 1);
+            for (uint8_t m : moved) any |= m != 0;
+        } else {
+            any = rows(0, a.count);
+        }
+        if (any) tcol.changedTick = std::max(tcol.changedTick, tick);
+    }
 }
 
 void actuatorFlushSystem(ecs::World& world) {
@@ -36,11 +89,59 @@ void actuatorFlushSystem(ecs::World& world) {
     if (!ref || !ref->world) return;
     physics::PhysicsWorld& pw = *ref->world;
 
-    world.query<Joint, JointCommand>().each(
-        [&](ecs::Entity, Joint& j, JointCommand& c) {
+    // Gather commands by joint index. If the <Joint, JointCommand> entities cover joint indices
+    // [0, n) exactly once (the builder's layout) with live handles, push them as two bulk SoA
+    // writes; otherwise (sparse / shared / stale joints) fall back to per-joint setters, which
+    // reject stale handles and leave uncovered joints with their command.
+    const std::span<const uint32_t> generations = pw.jointGenerations();
+    thread_local std::vector<physics::Real> targets, torques;
+    thread_local std::vector<uint8_t>       covered;
+    targets.clear(); torques.clear(); covered.clear();
+    size_t count = 0;
+    bool   dense = true;
+    world.query<const Joint, const JointCommand>().each(
+        [&](ecs::Entity, const Joint& j, const JointCommand& c) {
+            const size_t i = j.joint.index;
+            // A destroyed joint's slot may already hold another joint: never bulk-write it.
+            dense &= i < generations.size() && generations[i] == j.joint.generation;
+            if (i >= targets.size()) { targets.resize(i + 1, 0); torques.resize(i + 1, 0); covered.resize(i + 1, 0); }
+            dense &= covered[i] == 0;
+            covered[i] = 1;
+            targets[i] = c.target;
+            torques[i] = c.torque;
+            ++count;
+        });
+    if (count == 0) return;
+
+    if (dense && count == targets.size()) {
+        pw.setJointTargets(targets);
+        pw.setJointTorques(torques);
+        return;
+    }
+    world.query<const Joint, const JointCommand>().each(
+        [&](ecs::Entity, const Joint& j, const JointCommand& c) {
             pw.setJointTarget(j.joint, c.target);
             pw.setJointTorque(j.joint, c.torque);
         });
 }
 
+// Exclusive: the step may parallelize over WorldDef::threadPool, which must not be entered from
+// inside another pool task (no nested parallelFor).
+ecs::SystemAccess stepSystemAccess() {
+    ecs::SystemAccess a;
+    a.resources<PhysicsWorldRef, const FixedStep>();
+    a.exclusive = true;
+    return a;
+}
+
+ecs::SystemAccess syncSystemAccess() {
+    return ecs::SystemAccess{}.components<const RigidBody, engine::Transform>()
+                              .resources<const PhysicsWorldRef>();
+}
+
+ecs::SystemAccess actuatorFlushSystemAccess() {
+    return ecs::SystemAccess{}.components<const Joint, const JointCommand>()
+                              .resources<PhysicsWorldRef>();
+}
+
 } // namespace engine::physics_ecs
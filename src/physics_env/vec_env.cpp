@@ -49,6 +49,8 @@ void VecEnv::step() {
         envs_[i]->step();
         packObs(i);
     });
+    stats_ = physics::StepStats{};
+    for (const auto& e : envs_) physics::accumulate(stats_, e->stepStats());
 }
 
 } // namespace engine::physics_env
@@ -19,33 +19,76 @@
 
 namespace engine::scene {
 
+namespace {
+
+render::InstanceData makeInstance(const engine::Transform& t, const RenderMaterial& mat) {
+    render::InstanceData d;
+    d.model = t.matrix();
+    d.normalModel = d.model;   // TODO: transpose(inverse) for non-uniform scale
+    d.materialIndex = mat.materialIndex;
+    return d;
+}
+
+} // namespace
+
 void extract(ecs::World& world, ExtractedScene& out) {
+    out.updated = 0;
+
+    // Same entity layout + no mesh reassignment ⇒ the buckets still hold; patch changed instances.
+    bool rebuild = out.structureVersion != world.structureVersion();
+    if (!rebuild) {
+        world.query<const RenderMesh>().changed<RenderMesh>(out.since).chunks(
+            [&](std::span<const RenderMesh>) { rebuild = true; });
+    }
+    if (!rebuild) {
+        world.query<const engine::Transform, const RenderMaterial>()
+            .changed<engine::Transform, RenderMaterial>(out.since)
+            .each([&](ecs::Entity e, const engine::Transform& t, const RenderMaterial& mat) {
+                if (e.index >= out.instanceOf.size() || out.instanceOf[e.index] == ~0u) return;
+                out.instances[out.instanceOf[e.index]] = makeInstance(t, mat);
+                ++out.updated;
+            });
+        out.since = world.changeTick();
+        return;
+    }
+
     out.instances.clear();
     out.items.clear();
+    out.instanceOf.clear();
 
     // Bucket instances by mesh so each mesh becomes one contiguous instanced draw.
     // (ordered map → deterministic item order; a flat radix/sort is the scaling follow-up.)
-    std::map<uint32_t, std::vector<render::InstanceData>> byMesh;
-    std::map<uint32_t, render::MeshHandle>                meshOf;
-
-    world.query<engine::Transform, RenderMesh, RenderMaterial>().each(
-        [&](ecs::Entity, engine::Transform& t, RenderMesh& rm, RenderMaterial& mat) {
-            render::InstanceData d;
-            d.model = t.matrix();
-            d.normalModel = d.model;   // TODO: transpose(inverse) for non-uniform scale
-            d.materialIndex = mat.materialIndex;
-            byMesh[rm.mesh.index].push_back(d);
-            meshOf[rm.mesh.index] = rm.mesh;
+    struct Bucket {
+        render::MeshHandle                mesh;
+        std::vector<render::InstanceData> instances;
+        std::vector<uint32_t>             entities;   // entity index per instance
+    };
+    std::map<uint32_t, Bucket> byMesh;
+
+    world.query<const engine::Transform, const RenderMesh, const RenderMaterial>().each(
+        [&](ecs::Entity e, const engine::Transform& t, const RenderMesh& rm, const RenderMaterial& mat) {
+            Bucket& b = byMesh[rm.mesh.index];
+            b.mesh = rm.mesh;
+            b.instances.push_back(makeInstance(t, mat));
+            b.entities.push_back(e.index);
         });
 
-    for (auto& [meshIdx, insts] : byMesh) {
+    for (auto& [meshIdx, b] : byMesh) {
         render::RenderItem item;
-        item.mesh = meshOf[meshIdx];
+        item.mesh = b.mesh;
         item.firstInstance = static_cast<uint32_t>(out.instances.size());
-        item.instanceCount = static_cast<uint32_t>(insts.size());
+        item.instanceCount = static_cast<uint32_t>(b.instances.size());
         out.items.push_back(item);
-        out.instances.insert(out.instances.end(), insts.begin(), insts.end());
+        for (size_t i = 0; i < b.entities.size(); ++i) {
+            if (b.entities[i] >= out.instanceOf.size()) out.instanceOf.resize(b.entities[i] + 1, ~0u);
+            out.instanceOf[b.entities[i]] = item.firstInstance + static_cast<uint32_t>(i);
+        }
+        out.instances.insert(out.instances.end(), b.instances.begin(), b.instances.end());
     }
+
+    out.structureVersion = world.structureVersion();
+    out.updated = static_cast<uint32_t>(out.instances.size());
+    out.since = world.changeTick();
 }
 
 void extractViews(ecs::World& world, const ExtractedScene& scene,
@@ -54,8 +97,8 @@ void extractViews(ecs::World& world, const ExtractedScene& scene,
     outViews.clear();
     const float aspect = height ? static_cast<float>(width) / static_cast<float>(height) : 1.0f;
 
-    world.query<engine::Transform, engine::Camera>().each(
-        [&](ecs::Entity, engine::Transform& t, engine::Camera& cam) {
+    world.query<const engine::Transform, const engine::Camera>().each(
+        [&](ecs::Entity, const engine::Transform& t, const engine::Camera& cam) {
             render::RenderView v;
             // View = inverse of the rigid pose (position + rotation; scale ignored for a camera).
             const glm::mat4 pose = glm::translate(glm::mat4(1.0f), t.position) * glm::mat4_cast(t.rotation);
@@ -0,0 +1,235 @@
+#include "harness/harness.h"
+//
+//  world.cpp
+//  engine::tst / ecs / benchmark
+//
+//  ECS storage baseline at the 100k+ milestone scale: spawn/destroy churn, 1–4 component
+//  iteration (.each and .chunks), fragmentation across many archetypes, change-filtered
+//  iteration, resource access, and Schedule thread scaling. Prints ns/entity (lower is better);
+//  not pass/fail. Run in an optimized build:
+//    ./build/tst/benchmarks --module ecs
+//
+//  NOTE: absolute numbers depend on hardware and load — compare before/after on the SAME machine.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "engine/core/math/transform.h"
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/ecs.h"
+
+using namespace engine;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Velocity { glm::vec3 v{ 0.0f, -1.0f, 0.0f }; };
+struct Mass     { float m = 1.0f; };
+struct Health   { float hp = 100.0f; };
+template <int N> struct Tag { uint32_t v = N; };   // distinct types → distinct archetypes
+
+struct Config { float dt = 1.0f / 60.0f; };
+
+double seconds(Clock::time_point t0) { return std::chrono::duration<double>(Clock::now() - t0).count(); }
+
+// Best-of-`reps` time of fn().
+template <class F>
+double best(int reps, F&& fn) {
+    double b = 1e18;
+    for (int r = 0; r < reps; ++r) {
+        const auto t0 = Clock::now();
+        fn();
+        b = std::min(b, seconds(t0));
+    }
+    return b;
+}
+
+void spawnFull(ecs::World& w, int n) {
+    for (int i = 0; i < n; ++i)
+        w.spawn(Transform{ .position = glm::vec3(float(i), 0, 0) }, Velocity{}, Mass{}, Health{});
+}
+
+template <size_t... I>
+void spawnFragmented(ecs::World& w, int n, std::index_sequence<I...>) {
+    constexpr int kArchetypes = sizeof...(I);
+    for (int i = 0; i < n; ++i) {
+        const int a = i % kArchetypes;
+        ((a == int(I) ? (void)w.spawn(Transform{}, Velocity{}, Tag<int(I)>{}) : void()), ...);
+    }
+}
+
+void row(const char* name, int n, double secs) {
+    std::printf("  %-36s %8d  %10.2f ms  %8.2f ns/entity\n", name, n, secs * 1e3, secs * 1e9 / n);
+}
+
+} // namespace
+
+TST_CASE(ecs, benchmark, world) {
+#ifdef NDEBUG
+    const char* build = "Release/optimized";
+#else
+    const char* build = "Debug (unoptimized — expect much slower)";
+#endif
+    std::printf("ecs benchmark — build: %s\n", build);
+    constexpr int N = 131072;
+
+    // --- spawn / destroy churn ---
+    std::printf("\nspawn / destroy churn:\n");
+    {
+        std::vector<ecs::Entity> es;
+        es.reserve(N);
+        ecs::World w;
+        auto t0 = Clock::now();
+        for (int i = 0; i < N; ++i) es.push_back(w.spawn(Transform{}, Velocity{}));
+        row("spawn <Transform,Velocity>", N, seconds(t0));
+
+        std::mt19937 rng(1);
+        std::shuffle(es.begin(), es.end(), rng);
+        t0 = Clock::now();
+        for (int i = 0; i < N / 2; ++i) w.destroy(es[size_t(i)]);
+        row("destroy half (random order)", N / 2, seconds(t0));
+
+        t0 = Clock::now();
+        for (int i = 0; i < N / 2; ++i) w.spawn(Transform{}, Velocity{});
+        row("respawn half (free-list reuse)", N / 2, seconds(t0));
+
+        // Steady-state churn: destroy + spawn one entity per iteration.
+        std::vector<ecs::Entity> live;
+        w.query<const Transform>().each([&](ecs::Entity e, const Transform&) { live.push_back(e); });
+        t0 = Clock::now();
+        for (int i = 0; i < N; ++i) {
+            const size_t k = rng() % live.size();
+            w.destroy(live[k]);
+            live[k] = w.spawn(Transform{}, Velocity{});
+        }
+        row("churn (destroy+spawn pair)", N, seconds(t0));
+    }
+
+    // --- iteration, 1..4 components ---
+    std::printf("\niteration over %d entities <Transform,Velocity,Mass,Health> (best of 5):\n", N);
+    {
+        ecs::World w;
+        spawnFull(w, N);
+        const float dt = 1.0f / 60.0f;
+        row("each<Transform>", N, best(5, [&] {
+            w.query<Transform>().each([&](ecs::Entity, Transform& t) { t.position.x += dt; });
+        }));
+        row("each<Transform,const Velocity>", N, best(5, [&] {
+            w.query<Transform, const Velocity>().each(
+                [&](ecs::Entity, Transform& t, const Velocity& v) { t.position += v.v * dt; });
+        }));
+        row("each<Transform,Velocity,const Mass>", N, best(5, [&] {
+            w.query<Transform, Velocity, const Mass>().each(
+                [&](ecs::Entity, Transform& t, Velocity& v, const Mass& m) {
+                    v.v.y -= 9.81f * dt / m.m;
+                    t.position += v.v * dt;
+                });
+        }));
+        row("each<4 components>", N, best(5, [&] {
+            w.query<Transform, Velocity, const Mass, Health>().each(
+                [&](ecs::Entity, Transform& t, Velocity& v, const Mass& m, Health& h) {
+                    v.v.y -= 9.81f * dt / m.m;
+                    t.position += v.v * dt;
+                    h.hp -= dt;
+                });
+        }));
+        row("each<const Transform> (read-only)", N, best(5, [&] {
+            float s = 0.0f;
+            w.query<const Transform>().each([&](ecs::Entity, const Transform& t) { s += t.position.x; });
+            if (s == -1.0f) std::printf("!");
+        }));
+        row("chunks<Transform,const Velocity>", N, best(5, [&] {
+            w.query<Transform, const Velocity>().chunks([&](std::span<Transform> ts, std::span<const Velocity> vs) {
+                for (size_t i = 0; i < ts.size(); ++i) ts[i].position += vs[i].v * dt;
+            });
+        }));
+
+        // Change-filtered: 1% of rows touched since the last pass.
+        const uint32_t since = w.advanceTick();
+        int k = 0;
+        w.query<Transform>().each([&](ecs::Entity, Transform& t) {
+            if (k++ % 100 != 0) return false;
+            t.position.z += 1.0f;
+            return true;
+        });
+        int seen = 0;
+        const double filtered = best(5, [&] {
+            seen = 0;
+            w.query<const Transform>().changed<Transform>(since).each([&](ecs::Entity, const Transform&) { ++seen; });
+        });
+        std::printf("  %-36s %8d  %10.2f ms  %8.2f ns/entity scanned (%d changed)\n",
+                    "changed<Transform> (1% dirty)", N, filtered * 1e3, filtered * 1e9 / N, seen);
+    }
+
+    // --- fragmentation ---
+    std::printf("\nfragmentation: <Transform,Velocity> split across K archetypes (best of 5):\n");
+    {
+        auto fragmented = [&](auto seq, const char* name) {
+            ecs::World w;
+            spawnFragmented(w, N, seq);
+            row(name, N, best(5, [&] {
+                w.query<Transform, const Velocity>().each(
+                    [](ecs::Entity, Transform& t, const Velocity& v) { t.position += v.v; });
+            }));
+        };
+        fragmented(std::make_index_sequence<1>{},   "K=1");
+        fragmented(std::make_index_sequence<16>{},  "K=16");
+        fragmented(std::make_index_sequence<64>{},  "K=64");
+        fragmented(std::make_index_sequence<128>{}, "K=128");
+    }
+
+    // --- resource access ---
+    std::printf("\nresource access:\n");
+    {
+        ecs::World w;
+        w.setResource(Config{});
+        w.setResource(Health{});
+        constexpr int kCalls = 1 << 22;
+        float acc = 0.0f;
+        const double t = best(3, [&] {
+            for (int i = 0; i < kCalls; ++i) acc += w.getResource<Config>()->dt;
+        });
+        std::printf("  %-36s %8d  %10.2f ms  %8.2f ns/call\n", "getResource<Config>", kCalls, t * 1e3, t * 1e9 / kCalls);
+        if (acc == -1.0f) std::printf("!");
+    }
+
+    // --- Schedule thread scaling: 4 independent declared systems over N entities each ---
+    std::printf("\nSchedule thread scaling (4 disjoint systems x %d entities, best of 5):\n", N);
+    {
+        ecs::World w;
+        spawnFull(w, N);
+        ecs::Schedule s;
+        const float dt = 1.0f / 60.0f;
+        s.add("transform", ecs::SystemAccess{}.components<Transform>(), [&](ecs::World& world) {
+            world.query<Transform>().each([&](ecs::Entity, Transform& t) { t.position.x += dt; });
+        });
+        s.add("velocity", ecs::SystemAccess{}.components<Velocity>(), [&](ecs::World& world) {
+            world.query<Velocity>().each([&](ecs::Entity, Velocity& v) { v.v.y -= 9.81f * dt; });
+        });
+        s.add("mass", ecs::SystemAccess{}.components<Mass>(), [&](ecs::World& world) {
+            world.query<Mass>().each([&](ecs::Entity, Mass& m) { m.m = m.m * 0.999f + 0.001f; });
+        });
+        s.add("health", ecs::SystemAccess{}.components<Health>(), [&](ecs::World& world) {
+            world.query<Health>().each([&](ecs::Entity, Health& h) { h.hp -= dt; });
+        });
+        const double serial = best(5, [&] { s.run(w); });
+        std::printf("  %-12s %10.2f ms  %8.2f ns/entity-system\n", "serial", serial * 1e3, serial * 1e9 / (4.0 * N));
+        for (unsigned threads : { 1u, 2u, 4u }) {
+            core::ThreadPool pool(threads);
+            const double t = best(5, [&] { s.run(w, pool); });
+            std::printf("  workers=%-4u %10.2f ms  %8.2f ns/entity-system  (%.2fx vs serial)\n",
+                        pool.workerCount(), t * 1e3, t * 1e9 / (4.0 * N), serial / t);
+        }
+    }
+
+    std::printf("\necs benchmark done\n");
+}
@@ -4,16 +4,19 @@
 //
 //  Driver test for the ECS ordered scheduler + resources: a gravity system then an integrate
 //  system, both reading a Time{dt} resource and iterating via queries. Runs two fixed steps
-//  and checks the result against a hand computation (deterministic).
+//  and checks the result against a hand computation (deterministic). parallel_schedule covers
+//  read/write-declared batching and checks the pooled run against the serial one.
 //
 
 #include "harness/harness.h"
 #include <cmath>
 #include <cstdio>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 #include "engine/core/core.h"     // engine::Transform
+#include "engine/core/threading/thread_pool.h"
 #include "engine/ecs/ecs.h"
 
 namespace {
@@ -66,3 +69,73 @@ TST_CASE(ecs, integration, scheduler) {
 
     std::printf("scheduler ok\n");
 }
+
+// Read/write-declared systems: conflicting systems keep insertion order across batches,
+// non-conflicting ones share a batch, and the pooled run matches the serial run exactly.
+TST_CASE(ecs, integration, parallel_schedule) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    struct Spin { float angle = 0.0f; };
+    struct Score { int hits = 0; };
+
+    auto build = [](World& w) {
+        for (int i = 0; i < 1000; ++i) w.spawn(Transform{}, Velocity{ glm::vec3(0.0f) });
+        for (int i = 0; i < 500; ++i)  w.spawn(Spin{});
+        w.setResource(Time{ 0.5f });
+        w.setResource(Score{});
+    };
+
+    Schedule schedule;
+    schedule.add("gravity", SystemAccess{}.components<Velocity>().resources<const Time>(), [](World& w) {
+        const float dt = w.getResource<Time>()->dt;
+        w.query<Velocity>().each([&](Entity, Velocity& vel) { vel.v.y -= 10.0f * dt; });
+    });
+    schedule.add("spin", SystemAccess{}.components<Spin>().resources<const Time>(), [](World& w) {
+        const float dt = w.getResource<Time>()->dt;
+        w.query<Spin>().each([&](Entity, Spin& s) { s.angle += dt; });
+    });
+    schedule.add("integrate", SystemAccess{}.components<Transform, const Velocity>().resources<const Time>(),
+                 [](World& w) {
+        const float dt = w.getResource<Time>()->dt;
+        w.query<Transform, const Velocity>().each([&](Entity, Transform& t, const Velocity& vel) {
+            t.position += vel.v * dt;
+        });
+    });
+    schedule.add("score", SystemAccess{}.components<const Transform>().resources<Score>(), [](World& w) {
+        int below = 0;
+        w.query<const Transform>().each([&](Entity, const Transform& t) { if (t.position.y < 0.0f) ++below; });
+        w.getResource<Score>()->hits += below;
+    });
+
+    // gravity + spin share batch 0; integrate (reads Velocity) follows gravity; score follows integrate.
+    const auto& batches = schedule.batches();
+    TST_REQUIRE(batches.size() == 3);
+    TST_REQUIRE(batches[0].size() == 2);
+    TST_REQUIRE(schedule.systems()[2].batch == 1 && schedule.systems()[3].batch == 2);
+
+    // An undeclared system is exclusive: it lands after everything before it, alone.
+    Schedule withExclusive = schedule;
+    withExclusive.add("exclusive", [](World&) {});
+    TST_REQUIRE(withExclusive.batches().size() == 4 && withExclusive.batches()[3].size() == 1);
+
+    World serial, parallel;
+    build(serial);
+    build(parallel);
+    core::ThreadPool pool(4);
+    for (int s = 0; s < 3; ++s) {
+        schedule.run(serial);
+        schedule.run(parallel, pool);
+    }
+
+    TST_REQUIRE(serial.getResource<Score>()->hits == parallel.getResource<Score>()->hits);
+    TST_REQUIRE(parallel.getResource<Score>()->hits == 3000);
+    std::vector<float> ys, yp;
+    serial.query<const Transform>().each([&](Entity, const Transform& t) { ys.push_back(t.position.y); });
+    parallel.query<const Transform>().each([&](Entity, const Transform& t) { yp.push_back(t.position.y); });
+    TST_REQUIRE(ys == yp);
+    // Three steps at dt = 0.5: vy = -5, -10, -15 → y = -2.5 - 5 - 7.5 = -15.
+    TST_APPROX(yp.front(), -15.0f, 1e-4f);
+
+    std::printf("parallel schedule ok (%zu batches)\n", batches.size());
+}
@@ -0,0 +1,94 @@
+//
+//  change_ticks.cpp
+//  engine::tst
+//
+//  Change detection: spawn + mutable access (get<T>, non-const query columns) stamp rows with
+//  the world's change tick; changed<T>(since) yields exactly the rows stamped after `since`;
+//  const access and bool-returning callbacks that report "no write" leave ticks alone; the
+//  Schedule advances the tick so a system sees writes made by later systems on its next run.
+//
+
+#include "harness/harness.h"
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "engine/core/core.h"        // engine::Transform
+#include "engine/ecs/ecs.h"
+
+namespace {
+struct Velocity { glm::vec3 v{0.0f}; };
+struct Frozen   {};
+}
+
+TST_CASE(ecs, unit, change_ticks) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    World world;
+    std::vector<Entity> moving, still;
+    for (int i = 0; i < 8; ++i) moving.push_back(world.spawn(Transform{}, Velocity{ glm::vec3(1, 0, 0) }));
+    for (int i = 0; i < 8; ++i) still.push_back(world.spawn(Transform{}, Frozen{}));
+
+    auto countChanged = [&](uint32_t since) {
+        int n = 0;
+        world.query<const Transform>().changed<Transform>(since).each([&](Entity, const Transform&) { ++n; });
+        return n;
+    };
+
+    // Everything spawned counts as changed; nothing is newer than the current tick.
+    TST_REQUIRE(countChanged(0) == 16);
+    uint32_t since = world.advanceTick();
+    TST_REQUIRE(countChanged(since) == 0);
+
+    // Const queries and const get() are reads.
+    world.query<const Transform, const Velocity>().each([](Entity, const Transform&, const Velocity&) {});
+    (void)world.get<const Transform>(still[0]);
+    TST_REQUIRE(countChanged(since) == 0);
+
+    // A mutable query stamps only the rows it visits (the moving archetype).
+    world.query<Transform, const Velocity>().each([](Entity, Transform& t, const Velocity& v) { t.position += v.v; });
+    TST_REQUIRE(countChanged(since) == 8);
+
+    // bool callback: stamp only where it reports a write.
+    since = world.advanceTick();
+    world.query<Transform, const Velocity>().each([&](Entity e, Transform&, const Velocity&) { return e == moving[3]; });
+    TST_REQUIRE(countChanged(since) == 1);
+
+    // get<T> stamps one row; the filter can name a component outside the query's set.
+    since = world.advanceTick();
+    world.get<Transform>(still[5])->position.y = 2.0f;
+    int frozenChanged = 0;
+    world.query<const Frozen>().changed<Transform>(since).each([&](Entity e, const Frozen&) {
+        TST_REQUIRE(e == still[5]);
+        ++frozenChanged;
+    });
+    TST_REQUIRE(frozenChanged == 1);
+
+    // Swap-remove carries the moved row's tick along with its data.
+    since = world.advanceTick();
+    world.get<Transform>(moving.back());
+    world.destroy(moving[0]);
+    int seen = 0;
+    world.query<const Transform>().changed<Transform>(since).each([&](Entity e, const Transform&) {
+        TST_REQUIRE(e == moving.back());
+        ++seen;
+    });
+    TST_REQUIRE(seen == 1);
+
+    // Schedule: `observe` (first) sees the writes `move` (second) made during the previous run.
+    Schedule schedule;
+    uint32_t observed = 0, lastRun = world.changeTick();
+    schedule.add("observe", [&](World& w) {
+        w.query<const Transform>().changed<Transform>(lastRun).each([&](Entity, const Transform&) { ++observed; });
+        lastRun = w.changeTick();
+    });
+    schedule.add("move", [](World& w) {
+        w.query<Transform, const Velocity>().each([](Entity, Transform& t, const Velocity& v) { t.position += v.v; });
+    });
+    schedule.run(world);
+    observed = 0;
+    schedule.run(world);
+    TST_REQUIRE(observed == 7);
+}
@@ -0,0 +1,119 @@
+//
+//  hierarchy.cpp
+//  engine::tst
+//
+//  TransformHierarchy: world matrices compose down parent chains, only dirty branches are
+//  recomputed (moving a leaf touches one node, moving a root its whole subtree, nothing moved →
+//  nothing), re-parenting and destroying a parent relayout, and the pooled update matches the
+//  serial one over many small trees and over one wide tree.
+//
+
+#include "harness/harness.h"
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "engine/core/core.h"        // engine::Transform
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/ecs.h"
+
+namespace {
+glm::vec3 worldPos(engine::ecs::World& w, engine::ecs::Entity e) {
+    return glm::vec3(w.get<const engine::ecs::WorldTransform>(e)->matrix[3]);
+}
+}
+
+TST_CASE(ecs, unit, hierarchy) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    World world;
+    const Entity root = world.spawn(Transform{ .position = glm::vec3(1, 0, 0) }, WorldTransform{});
+    const Entity mid  = world.spawn(Transform{ .position = glm::vec3(0, 2, 0) }, WorldTransform{}, Parent{ root });
+    const Entity leaf = world.spawn(Transform{ .position = glm::vec3(0, 0, 3) }, WorldTransform{}, Parent{ mid });
+    const Entity solo = world.spawn(Transform{ .position = glm::vec3(5, 5, 5) }, WorldTransform{});
+    // A third level under `leaf`.
+    const Entity late = world.spawn(Transform{ .position = glm::vec3(1, 0, 0) }, WorldTransform{}, Parent{ leaf });
+
+    world.setResource(TransformHierarchy{});
+    TransformHierarchy& h = *world.getResource<TransformHierarchy>();
+    h.update(world);
+    TST_REQUIRE(h.nodeCount() == 5 && h.maxDepth() == 3 && h.lastUpdated() == 5);
+    TST_REQUIRE(worldPos(world, leaf) == glm::vec3(1, 2, 3));
+    TST_REQUIRE(worldPos(world, late) == glm::vec3(2, 2, 3));
+    TST_REQUIRE(worldPos(world, solo) == glm::vec3(5, 5, 5));
+
+    world.advanceTick();
+    h.update(world);
+    TST_REQUIRE(h.lastUpdated() == 0);
+
+    // Leaf only.
+    world.advanceTick();
+    world.get<Transform>(late)->position = glm::vec3(0, 1, 0);
+    h.update(world);
+    TST_REQUIRE(h.lastUpdated() == 1);
+    TST_REQUIRE(worldPos(world, late) == glm::vec3(1, 3, 3));
+
+    // Root (rotated 90° about z) → its whole branch, not `solo`.
+    world.advanceTick();
+    world.get<Transform>(root)->rotation = glm::angleAxis(glm::radians(90.0f), glm::vec3(0, 0, 1));
+    h.update(world);
+    TST_REQUIRE(h.lastUpdated() == 4);
+    TST_APPROX(worldPos(world, mid).x, -1.0f, 1e-5);   // (0,2,0) rotated → (-2,0,0), + (1,0,0)
+    TST_APPROX(worldPos(world, mid).y, 0.0f, 1e-5);
+
+    // Re-parent `late` under `solo`.
+    world.advanceTick();
+    world.get<Parent>(late)->entity = solo;
+    h.update(world);
+    TST_REQUIRE(worldPos(world, late) == glm::vec3(5, 6, 5));
+
+    // Destroying a parent orphans its children (they become roots).
+    world.advanceTick();
+    world.destroy(root);
+    h.update(world);
+    TST_REQUIRE(h.nodeCount() == 4);
+    TST_REQUIRE(worldPos(world, mid) == glm::vec3(0, 2, 0));
+
+    // Many independent subtrees: pooled propagation == serial.
+    World a, b;
+    for (World* w : { &a, &b }) {
+        for (int r = 0; r < 600; ++r) {
+            Entity p = w->spawn(Transform{ .position = glm::vec3(float(r), 0, 0) }, WorldTransform{});
+            for (int d = 0; d < 4; ++d)
+                p = w->spawn(Transform{ .position = glm::vec3(0, 1, 0), .scale = glm::vec3(1.5f) }, WorldTransform{}, Parent{ p });
+        }
+    }
+    core::ThreadPool pool(4);
+    TransformHierarchy serial, pooled;
+    pooled.pool = &pool;
+    serial.update(a);
+    pooled.update(b);
+    TST_REQUIRE(pooled.lastUpdated() == 3000);
+    std::vector<glm::mat4> ma, mb;
+    a.query<const WorldTransform>().each([&](Entity, const WorldTransform& t) { ma.push_back(t.matrix); });
+    b.query<const WorldTransform>().each([&](Entity, const WorldTransform& t) { mb.push_back(t.matrix); });
+    TST_REQUIRE(ma == mb);
+    TST_APPROX(ma.back()[3].y, 1.0f + 1.5f + 2.25f + 3.375f, 1e-4);
+
+    // One wide tree (a root, 2000 children, a grandchild each): its levels split across the pool.
+    World c, d;
+    for (World* w : { &c, &d }) {
+        const Entity top = w->spawn(Transform{ .position = glm::vec3(0, 1, 0) }, WorldTransform{});
+        for (int k = 0; k < 2000; ++k) {
+            const Entity child = w->spawn(Transform{ .position = glm::vec3(float(k), 0, 0) }, WorldTransform{}, Parent{ top });
+            w->spawn(Transform{ .position = glm::vec3(0, 0, 1) }, WorldTransform{}, Parent{ child });
+        }
+    }
+    TransformHierarchy wideSerial, widePooled;
+    widePooled.pool = &pool;
+    wideSerial.update(c);
+    widePooled.update(d);
+    TST_REQUIRE(widePooled.lastUpdated() == 4001 && widePooled.maxDepth() == 2);
+    ma.clear(); mb.clear();
+    c.query<const WorldTransform>().each([&](Entity, const WorldTransform& t) { ma.push_back(t.matrix); });
+    d.query<const WorldTransform>().each([&](Entity, const WorldTransform& t) { mb.push_back(t.matrix); });
+    TST_REQUIRE(ma == mb);
+    TST_REQUIRE(ma.back()[3] == glm::vec4(1999, 1, 1, 1));
+}
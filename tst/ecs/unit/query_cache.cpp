@@ -0,0 +1,70 @@
+//
+//  query_cache.cpp
+//  engine::tst
+//
+//  Cached query matching: a QueryState picks up archetypes created after its first refresh,
+//  keeps matches in creation order, skips emptied tables, and World::query results stay the
+//  same as a fresh state's. Also checks the ComponentMask signature on each archetype.
+//
+
+#include "harness/harness.h"
+
+#include <glm/glm.hpp>
+
+#include "engine/core/core.h"        // engine::Transform
+#include "engine/ecs/ecs.h"
+
+namespace {
+struct Velocity { glm::vec3 v{0.0f}; };
+struct Tag      { int id = 0; };
+}
+
+TST_CASE(ecs, unit, query_cache) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    World world;
+    for (int i = 0; i < 10; ++i) world.spawn(Transform{}, Velocity{ glm::vec3(1, 0, 0) });
+
+    QueryState<Transform, const Velocity> state;
+    state.refresh(world);
+    TST_REQUIRE(state.matches().size() == 1);
+
+    // Archetype bitsets mirror the sorted signature.
+    for (const Archetype& a : world.archetypes()) {
+        TST_REQUIRE(a.mask.count() == a.signature.size());
+        for (ComponentId id : a.signature) TST_REQUIRE(a.has(id));
+        TST_REQUIRE(a.hasAll(componentMask<Transform>()) == a.has(componentId<Transform>()));
+    }
+
+    // New archetypes after the first refresh: one matching, one not.
+    Entity tagged = world.spawn(Transform{}, Velocity{ glm::vec3(0, 1, 0) }, Tag{ 7 });
+    world.spawn(Transform{}, Tag{ 1 });
+    state.refresh(world);
+    TST_REQUIRE(state.matches().size() == 2);
+    TST_REQUIRE(state.matches()[0].archetype < state.matches()[1].archetype);
+
+    // Refresh with no new archetypes is a no-op.
+    state.refresh(world);
+    TST_REQUIRE(state.matches().size() == 2);
+
+    int rows = 0;
+    state.each(world, [&](Entity, Transform& t, const Velocity& v) { t.position += v.v; ++rows; });
+    TST_REQUIRE(rows == 11);
+    TST_REQUIRE(world.get<Transform>(tagged)->position.y == 1.0f);
+
+    // The world-owned cache and a fresh state agree, including after a table empties.
+    world.destroy(tagged);
+    size_t viaWorld = 0, viaFresh = 0;
+    world.query<Transform, const Velocity>().chunks(
+        [&](std::span<Transform> ts, std::span<const Velocity>) { viaWorld += ts.size(); });
+    QueryState<Transform, const Velocity> fresh;
+    fresh.refresh(world);
+    fresh.chunks(world, [&](std::span<Transform> ts, std::span<const Velocity>) { viaFresh += ts.size(); });
+    TST_REQUIRE(viaWorld == 10);
+    TST_REQUIRE(viaFresh == viaWorld);
+
+    int nT = 0;
+    world.query<Transform>().each([&](Entity, Transform&) { ++nT; });
+    TST_REQUIRE(nT == 11);
+}
@@ -0,0 +1,73 @@
+//
+//  resources.cpp
+//  engine::tst
+//
+//  Dense resource table: set/get/replace, unset → nullptr, non-trivial values destroyed with the
+//  world, per-world independence. Then id assignment under concurrency: worlds built on pool
+//  threads, each registering its own component + resource types, end up with distinct ids.
+//
+
+#include "harness/harness.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/core/threading/thread_pool.h"
+#include "engine/ecs/ecs.h"
+
+namespace {
+struct Gravity { float g = -9.81f; };
+struct Name    { std::string value; };                 // non-trivial resource
+struct Counted { std::shared_ptr<int> alive; };         // observes destruction
+struct Unset   { int x = 0; };
+
+template <int N> struct C { int v = N; };               // distinct component types
+template <int N> struct R { int v = N; };               // distinct resource types
+}
+
+TST_CASE(ecs, unit, resources) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    auto token = std::make_shared<int>(1);
+    {
+        World a, b;
+        a.setResource(Gravity{ -1.0f });
+        a.setResource(Name{ "arena" });
+        a.setResource(Counted{ token });
+        TST_REQUIRE(a.getResource<Gravity>()->g == -1.0f);
+        TST_REQUIRE(a.getResource<Name>()->value == "arena");
+        TST_REQUIRE(a.getResource<Unset>() == nullptr);
+        TST_REQUIRE(b.getResource<Gravity>() == nullptr);   // per-world
+
+        a.setResource(Name{ "replaced" });
+        TST_REQUIRE(a.getResource<Name>()->value == "replaced");
+
+        World moved = std::move(a);
+        TST_REQUIRE(moved.getResource<Gravity>()->g == -1.0f);
+        TST_REQUIRE(token.use_count() == 2);
+    }
+    TST_REQUIRE(token.use_count() == 1);   // destroyed with the world
+
+    // Parallel world construction: ids are claimed concurrently, all distinct.
+    core::ThreadPool pool(4);
+    std::vector<ComponentId> cids(8), rids(8);
+    std::vector<int>         values(8, -1);
+    pool.parallelFor(8, [&](size_t i) {
+        World w;
+        switch (i) {
+#define CASE(N) case N: w.spawn(C<N>{}); w.setResource(R<N>{}); \
+                        cids[i] = componentId<C<N>>(); rids[i] = resourceId<R<N>>(); \
+                        values[i] = w.getResource<R<N>>()->v; break;
+            CASE(0) CASE(1) CASE(2) CASE(3) CASE(4) CASE(5) CASE(6) CASE(7)
+#undef CASE
+        }
+    }, 1);
+    for (int i = 0; i < 8; ++i) TST_REQUIRE(values[size_t(i)] == i);
+    std::sort(cids.begin(), cids.end());
+    std::sort(rids.begin(), rids.end());
+    TST_REQUIRE(std::adjacent_find(cids.begin(), cids.end()) == cids.end());
+    TST_REQUIRE(std::adjacent_find(rids.begin(), rids.end()) == rids.end());
+}
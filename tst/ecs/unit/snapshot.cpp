@@ -0,0 +1,124 @@
+//
+//  snapshot.cpp
+//  engine::tst
+//
+//  World::snapshot / restore: a full snapshot round-trips rows, records (stale handles stay
+//  stale, destroyed entities come back) and POD resources; tables created afterwards are emptied;
+//  a fresh world restores to the same state. Delta snapshots store only differing chunks and
+//  restore against their base. Truncated or mismatched buffers are rejected without touching the
+//  world.
+//
+
+#include "harness/harness.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "engine/core/core.h"        // engine::Transform
+#include "engine/ecs/ecs.h"
+
+namespace {
+struct Velocity { glm::vec3 v{0.0f}; };
+struct Tag      { int id = 0; };
+struct Clock    { double t = 0.0; };
+
+float sumX(engine::ecs::World& w) {
+    float s = 0.0f;
+    w.query<const engine::Transform>().each([&](engine::ecs::Entity, const engine::Transform& t) { s += t.position.x; });
+    return s;
+}
+}
+
+TST_CASE(ecs, unit, snapshot) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    World world;
+    std::vector<Entity> es;
+    for (int i = 0; i < 4000; ++i)
+        es.push_back(world.spawn(Transform{ .position = glm::vec3(float(i), 0, 0) }, Velocity{ glm::vec3(1, 0, 0) }));
+    world.setResource(Clock{ 1.5 });
+    const float x0 = sumX(world);
+
+    std::vector<std::byte> full;
+    world.snapshot(full);
+
+    // Diverge: integrate, destroy, spawn into a new archetype, change a resource.
+    world.query<Transform, const Velocity>().each([](Entity, Transform& t, const Velocity& v) { t.position += v.v; });
+    world.destroy(es[10]);
+    const Entity late = world.spawn(Transform{}, Tag{ 3 });
+    world.getResource<Clock>()->t = 9.0;
+
+    world.restore(full);
+    TST_REQUIRE(world.size() == 4000);
+    TST_REQUIRE(sumX(world) == x0);
+    TST_REQUIRE(world.alive(es[10]) && world.get<const Transform>(es[10])->position.x == 10.0f);
+    TST_REQUIRE(!world.alive(late));
+    TST_REQUIRE(world.getResource<Clock>()->t == 1.5);
+
+    // A fresh world builds the same tables from the snapshot.
+    World copy;
+    copy.restore(full);
+    TST_REQUIRE(copy.size() == 4000 && sumX(copy) == x0);
+    TST_REQUIRE(copy.get<const Velocity>(es[7])->v.x == 1.0f);
+
+    // Delta: touch a handful of rows → only their chunks are stored.
+    for (int i = 0; i < 4; ++i) world.get<Transform>(es[size_t(i) * 1000])->position.y = 5.0f;
+    std::vector<std::byte> delta;
+    world.snapshot(delta, &full);
+    TST_REQUIRE(delta.size() < full.size() / 2);
+    const float x1 = sumX(world);
+
+    world.query<Transform>().each([](Entity, Transform& t) { t.position = glm::vec3(-1.0f); });
+    world.restore(delta, &full);
+    TST_REQUIRE(sumX(world) == x1);
+    TST_REQUIRE(world.get<const Transform>(es[2000])->position.y == 5.0f);
+    TST_REQUIRE(world.get<const Transform>(es[2001])->position.y == 0.0f);
+
+    // Restored rows count as changed.
+    const uint32_t since = world.advanceTick();
+    world.restore(full);
+    int changed = 0;
+    world.query<const Transform>().changed<Transform>(since).each([&](Entity, const Transform&) { ++changed; });
+    TST_REQUIRE(changed == 4000);
+}
+
+TST_CASE(ecs, unit, snapshot_rejects_bad_buffer) {
+    using namespace engine;
+    using namespace engine::ecs;
+
+    auto throws = [](World& w, const std::vector<std::byte>& buf, const std::vector<std::byte>* base = nullptr) {
+        try { w.restore(buf, base); } catch (const std::runtime_error&) { return true; }
+        return false;
+    };
+
+    World world;
+    const Entity first = world.spawn(Transform{}, Velocity{});
+    for (int i = 1; i < 100; ++i) world.spawn(Transform{ .position = glm::vec3(float(i), 0, 0) }, Velocity{});
+    std::vector<std::byte> full;
+    world.snapshot(full);
+    const float x0 = sumX(world);
+
+    // Truncated: every cut is caught, and the world keeps its rows.
+    for (size_t cut : { size_t(3), size_t(40), full.size() / 2, full.size() - 1 }) {
+        const std::vector<std::byte> part(full.begin(), full.begin() + static_cast<std::ptrdiff_t>(cut));
+        TST_REQUIRE(throws(world, part));
+        TST_REQUIRE(world.size() == 100 && sumX(world) == x0);
+    }
+
+    // Mismatched: a world whose first table has another signature.
+    World other;
+    other.spawn(Tag{ 1 });
+    TST_REQUIRE(throws(other, full));
+    TST_REQUIRE(other.size() == 1);
+
+    // A delta without its base.
+    world.get<Transform>(first)->position.y = 1.0f;
+    std::vector<std::byte> delta;
+    world.snapshot(delta, &full);
+    TST_REQUIRE(throws(world, delta));
+    TST_REQUIRE(!throws(world, delta, &full));
+}
@@ -94,6 +94,22 @@ TST_CASE(graphics, integration, scene) {
     renderer.setMeshPipeline(pipe);
     std::printf("extracted: %zu items, %zu instances\n", extracted.items.size(), extracted.instances.size());
 
+    // Incremental re-extract: nothing changed → nothing rewritten; touching one Transform rewrites
+    // exactly that instance (and leaves the batches as they were). The test owns the frame, so it
+    // starts each new change tick itself.
+    world.advanceTick();
+    scene::extract(world, extracted);
+    TST_REQUIRE(extracted.updated == 0);
+    ecs::Entity probe{};
+    world.query<const Transform, const scene::RenderMaterial>().each(
+        [&](ecs::Entity e, const Transform&, const scene::RenderMaterial& m) { if (m.materialIndex == 0) probe = e; });
+    const glm::vec3 center = world.get<const Transform>(probe)->position;
+    world.advanceTick();
+    world.get<Transform>(probe)->position = center;   // mutable access stamps the row
+    scene::extract(world, extracted);
+    TST_REQUIRE(extracted.updated == 1);
+    TST_REQUIRE(extracted.items.size() == 1 && extracted.instances.size() == 3);
+
     render::RenderView view;
     view.view = glm::lookAt(glm::vec3(0, 0, 3), glm::vec3(0), glm::vec3(0, 1, 0));
     view.proj = glm::perspective(glm::radians(50.0f), float(W) / float(H), 0.1f, 20.0f);
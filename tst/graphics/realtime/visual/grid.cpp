@@ -113,6 +113,7 @@ TST_CASE(graphics, visual, grid) {
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
         const float t = static_cast<float>(glfwGetTime());
+        world.advanceTick();   // no Schedule here: the loop owns the frame's change tick
 
         // "bob" system: animate each transform's Y from its X/Z (a query over the world).
         world.query<Transform>().each([&](ecs::Entity, Transform& tr) {
@@ -25,6 +25,9 @@
 #include "engine/core/math/transform.h"
 #include "engine/core/threading/thread_pool.h"
 #include "engine/ecs/ecs.h"
+#include "engine/physics/broadphase/hierarchical_grid.h"
+#include "engine/physics/broadphase/sweep_and_prune.h"
+#include "engine/physics/broadphase/uniform_grid.h"
 #include "engine/physics/world.h"
 #include "engine/physics_ecs/components.h"
 #include "engine/physics_ecs/systems.h"
@@ -108,6 +111,92 @@ std::unique_ptr<phys::PhysicsWorld> makePileWorld(int n, engine::core::ThreadPoo
     return world;
 }
 
+// Mixed sizes: small spheres scattered over a large static level (a 200 m floor slab plus four
+// 100 m walls). The grid sizes its cells to the largest box, so the level collapses it into a
+// few cells holding everything; the dynamic tree only reinserts the spheres that moved.
+std::unique_ptr<phys::PhysicsWorld> makeMixedWorld(int n, phys::BroadphaseKind bp) {
+    phys::WorldDef wd;
+    wd.gravity = phys::Vec3(0, -9.81f, 0);
+    wd.velocityIterations = 8;
+    wd.substeps = 1;
+    wd.broadphase = bp;
+    auto world = phys::createPhysicsWorld(phys::Backend::Realtime, wd);
+
+    auto slab = [&](phys::Vec3 center, phys::Vec3 half) {
+        phys::BodyDef b;
+        b.type = phys::BodyType::Static;
+        b.collider.type = phys::ColliderDesc::Type::Box;
+        b.collider.box = phys::Box{ half };
+        b.position = center;
+        world->createBody(b);
+    };
+    slab(phys::Vec3(0, -1, 0), phys::Vec3(100, 1, 100));
+    slab(phys::Vec3(-100, 10, 0), phys::Vec3(1, 10, 100));
+    slab(phys::Vec3(100, 10, 0), phys::Vec3(1, 10, 100));
+    slab(phys::Vec3(0, 10, -100), phys::Vec3(100, 10, 1));
+    slab(phys::Vec3(0, 10, 100), phys::Vec3(100, 10, 1));
+
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n))));
+    const float spacing = 180.0f / static_cast<float>(side);
+    for (int k = 0; k < n; ++k) {
+        phys::BodyDef b;
+        b.type = phys::BodyType::Dynamic;
+        b.mass = 1.0f;
+        b.collider.type = phys::ColliderDesc::Type::Sphere;
+        b.collider.sphere = phys::Sphere{ 0.25f };
+        b.position = phys::Vec3(-90.0f + (k % side) * spacing, 0.25f, -90.0f + (k / side) * spacing);
+        world->createBody(b);
+    }
+    return world;
+}
+
+// Many independent jointed chains (8 capsules, alternating ball/hinge joints) draped on a plane —
+// a joint-heavy scene of small islands, where graph coloring alone exposes no parallelism.
+std::unique_ptr<phys::PhysicsWorld> makeChainsWorld(int chains, engine::core::ThreadPool* pool) {
+    phys::WorldDef wd;
+    wd.gravity = phys::Vec3(0, -9.81f, 0);
+    wd.velocityIterations = 8;
+    wd.substeps = 2;
+    wd.threadPool = pool;
+    wd.parallelThreshold = 1024;
+    auto world = phys::createPhysicsWorld(phys::Backend::Realtime, wd);
+
+    phys::BodyDef plane;
+    plane.type = phys::BodyType::Static;
+    plane.collider.type = phys::ColliderDesc::Type::Plane;
+    plane.collider.plane = phys::Plane{ phys::Vec3(0, 1, 0), 0.0f };
+    world->createBody(plane);
+
+    for (int c = 0; c < chains; ++c) {
+        const float x = static_cast<float>(c % 32) * 6.0f;
+        const float z = static_cast<float>(c / 32) * 2.0f;
+        phys::BodyHandle prev{};
+        for (int k = 0; k < 8; ++k) {
+            phys::BodyDef b;
+            b.type = phys::BodyType::Dynamic;
+            b.mass = 1.0f;
+            b.collider.type = phys::ColliderDesc::Type::Capsule;
+            b.collider.capsule = phys::Capsule{ 0.1f, 0.2f };
+            b.collisionCategory = 2;
+            b.collisionMask = ~2u;   // links don't collide with each other, only the ground
+            b.position = phys::Vec3(x + 0.6f * k, 0.5f, z);
+            b.orientation = phys::Quat(0.70710678f, 0, 0, 0.70710678f);   // capsule axis along x
+            const phys::BodyHandle h = world->createBody(b);
+            if (k > 0) {
+                phys::JointDef j;
+                j.type = (k % 2) ? phys::JointType::Ball : phys::JointType::Revolute;
+                j.a = prev;
+                j.b = h;
+                j.localAnchorA = phys::Vec3(0, -0.3f, 0);
+                j.localAnchorB = phys::Vec3(0, 0.3f, 0);
+                world->createJoint(j);
+            }
+            prev = h;
+        }
+    }
+    return world;
+}
+
 // Median wall time (seconds) of a single world->step() over `steps` measured steps, `reps` reps.
 double benchRawStep(int n, int steps, int reps, int substeps, phys::BroadphaseKind bp) {
     double best = 1e18;
@@ -157,8 +246,11 @@ TST_CASE(physics, benchmark, step) {
     std::printf("scenario: free-falling spheres, no contacts (broadphase + integrate bound)\n\n");
 
     struct Bp { const char* name; phys::BroadphaseKind kind; };
-    for (const Bp bp : { Bp{ "sweep-and-prune", phys::BroadphaseKind::SweepAndPrune },
-                         Bp{ "uniform-grid",    phys::BroadphaseKind::UniformGrid } }) {
+    const Bp kinds[] = { Bp{ "sweep-and-prune", phys::BroadphaseKind::SweepAndPrune },
+                         Bp{ "uniform-grid",    phys::BroadphaseKind::UniformGrid },
+                         Bp{ "dynamic-tree",    phys::BroadphaseKind::DynamicTree },
+                         Bp{ "hierarchical-grid", phys::BroadphaseKind::HierarchicalGrid } };
+    for (const Bp bp : kinds) {
         std::printf("broadphase: %s\n", bp.name);
         std::printf("%8s | %12s | %12s | %14s | %16s\n",
                     "bodies", "us/step", "ms/step", "steps/sec", "body-steps/sec");
@@ -230,7 +322,7 @@ TST_CASE(physics, benchmark, step) {
         std::printf("\nintra-world (dense pile, %d bodies, workers=%u): "
                     "serial %.2f ms/step, parallel %.2f ms/step, speedup %.2fx\n",
                     N, pool.workerCount(), serial * 1e3, parallel * 1e3, serial / parallel);
-        std::printf("  (parallel stages: integration + narrowphase + colored solver)\n");
+        std::printf("  (parallel stages: integration + narrowphase + colored solver per island)\n");
     }
 
     // Intra-world, sparse: ONE large free-fall world, serial vs pooled (parallel entry sort +
@@ -256,5 +348,106 @@ TST_CASE(physics, benchmark, step) {
         std::printf("  (parallel stages: grid entry sort + integration)\n");
     }
 
+    // Intra-world, joint-heavy: many small jointed islands, serial vs pooled (islands solved as
+    // independent pool tasks).
+    {
+        const int   chains = 1024;
+        const int   S = 20;
+        const float dt = 1.0f / 120.0f;
+        engine::core::ThreadPool pool;
+
+        auto run = [&](engine::core::ThreadPool* p) {
+            auto w = makeChainsWorld(chains, p);
+            for (int s = 0; s < 5; ++s) w->step(dt);
+            const auto t0 = Clock::now();
+            for (int s = 0; s < S; ++s) w->step(dt);
+            return std::chrono::duration<double>(Clock::now() - t0).count() / S;
+        };
+        const double serial = run(nullptr);
+        const double parallel = run(&pool);
+        std::printf("\nintra-world (%d jointed chains, %d bodies, workers=%u): "
+                    "serial %.2f ms/step, parallel %.2f ms/step, speedup %.2fx\n",
+                    chains, chains * 8, pool.workerCount(), serial * 1e3, parallel * 1e3, serial / parallel);
+        std::printf("  (parallel stages: islands + narrowphase + integration)\n");
+    }
+
+    // Mixed sizes: small resting spheres on big static level geometry, per broadphase.
+    {
+        const float dt = 1.0f / 120.0f;
+        std::printf("\nmixed sizes (0.25 m spheres on a 200 m static level, serial):\n");
+        std::printf("%8s | %12s | %12s | %12s | %12s\n", "bodies", "sap ms/step", "grid ms/step",
+                    "tree ms/step", "hgrid ms/step");
+        std::printf("---------+--------------+--------------+--------------+--------------\n");
+        for (int n : { 1024, 4096, 16384 }) {
+            const int S = (n <= 4096) ? 30 : 10;
+            double ms[4];
+            for (int b = 0; b < 4; ++b) {
+                auto w = makeMixedWorld(n, kinds[b].kind);
+                for (int s = 0; s < 3; ++s) w->step(dt);
+                const auto t0 = Clock::now();
+                for (int s = 0; s < S; ++s) w->step(dt);
+                ms[b] = std::chrono::duration<double>(Clock::now() - t0).count() / S * 1e3;
+            }
+            std::printf("%8d | %12.3f | %12.3f | %12.3f | %12.3f\n", n, ms[0], ms[1], ms[2], ms[3]);
+        }
+    }
+
+    // Broadphase alone at a 1000:1 size ratio: 0.1 m pebbles over a 400 m field plus sixteen
+    // 100 m boulders. The uniform grid's cells grow to boulder size, so every cell run pairs
+    // thousands of pebbles; the hierarchical grid keeps pebbles in pebble-sized cells.
+    {
+        std::printf("\nbroadphase only, 1000:1 size ratio (0.1 m pebbles + 16 x 100 m boulders, best of 3):\n");
+        std::printf("%8s | %12s | %12s | %12s | %10s\n", "pebbles", "sap ms", "grid ms", "hgrid ms", "pairs");
+        std::printf("---------+--------------+--------------+--------------+-----------\n");
+        for (int n : { 16384, 65536 }) {
+            std::vector<phys::Aabb> boxes;
+            uint32_t seed = 1;
+            auto rnd = [&] { seed = seed * 1664525u + 1013904223u; return float(seed >> 8) / float(1u << 24); };
+            for (int k = 0; k < n; ++k) {
+                const phys::Vec3 c(rnd() * 400.0f - 200.0f, rnd() * 2.0f, rnd() * 400.0f - 200.0f);
+                boxes.push_back(phys::Aabb{ c - phys::Vec3(0.05f), c + phys::Vec3(0.05f) });
+            }
+            for (int k = 0; k < 16; ++k) {
+                const phys::Vec3 c(-150.0f + 100.0f * (k % 4), 0.0f, -150.0f + 100.0f * (k / 4));
+                boxes.push_back(phys::Aabb{ c - phys::Vec3(50.0f), c + phys::Vec3(50.0f) });
+            }
+            std::vector<phys::broadphase::Pair> pairs;
+            auto time = [&](auto&& fn) {
+                double best = 1e18;
+                for (int r = 0; r < 3; ++r) {
+                    const auto t0 = Clock::now();
+                    fn();
+                    best = std::min(best, std::chrono::duration<double>(Clock::now() - t0).count());
+                }
+                return best * 1e3;
+            };
+            const double sap = time([&] { phys::broadphase::sweepAndPrune(boxes, pairs); });
+            const double grid = time([&] { phys::broadphase::uniformGrid(boxes, pairs); });
+            const double hgrid = time([&] { phys::broadphase::hierarchicalGrid(boxes, pairs); });
+            std::printf("%8d | %12.3f | %12.3f | %12.3f | %10zu\n", n, sap, grid, hgrid, pairs.size());
+        }
+    }
+
+    // Body-storage scaling: serial step at 10k / 100k spheres, sparse (integration + broadphase
+    // bound) and dense (solver bound). Tracks the hot/cold body-array layout.
+    {
+        const float dt = 1.0f / 120.0f;
+        std::printf("\nbody storage (serial, uniform-grid):\n");
+        std::printf("%8s | %16s | %16s\n", "bodies", "free-fall ms/step", "pile ms/step");
+        std::printf("---------+------------------+------------------\n");
+        for (int n : { 10000, 100000 }) {
+            const int S = (n <= 10000) ? 30 : 10;
+            auto time = [&](std::unique_ptr<phys::PhysicsWorld> w) {
+                for (int s = 0; s < 3; ++s) w->step(dt);
+                const auto t0 = Clock::now();
+                for (int s = 0; s < S; ++s) w->step(dt);
+                return std::chrono::duration<double>(Clock::now() - t0).count() / S;
+            };
+            const double fall = time(makeFreefallWorld(n, 1, phys::BroadphaseKind::UniformGrid));
+            const double pile = time(makePileWorld(n, nullptr));
+            std::printf("%8d | %16.3f | %16.3f\n", n, fall * 1e3, pile * 1e3);
+        }
+    }
+
     std::printf("\nbenchmark done\n");
 }
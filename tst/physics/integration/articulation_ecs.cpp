@@ -8,10 +8,13 @@
 //  actuatorFlush → step → sync advances physics and copies poses back into Transforms.
 //
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <vector>
 
 #include "engine/core/math/transform.h"
+#include "engine/core/threading/thread_pool.h"
 #include "engine/ecs/ecs.h"
 #include "engine/physics/physics.h"
 #include "engine/physics/world.h"
@@ -75,3 +78,125 @@ TST_CASE(physics, integration, articulation_ecs) {
     TST_REQUIRE(maxErr < 1e-5f);   // Transforms track physics poses exactly
     TST_REQUIRE(minY > -0.3f);     // settled on the floor, didn't sink through
 }
+
+// Bulk bridge paths: actuatorFlush's bulk SoA write (dense joint coverage) and its per-joint
+// fallback (sparse coverage) drive the world exactly like hand-written per-joint setters, and
+// a pooled syncPoses over a large table matches the serial scatter, stamps only moved rows and
+// skips handles whose slot was reused; the flush ignores a stale joint handle the same way.
+TST_CASE(physics, integration, ecs_bulk_bridge) {
+    auto makeWorld = [] {
+        physics::WorldDef wd;
+        wd.gravity = physics::Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        auto w = physics::createPhysicsWorld(physics::Backend::Realtime, wd);
+        physics::BodyDef g;
+        g.type = physics::BodyType::Static;
+        g.collider.type = physics::ColliderDesc::Type::Plane;
+        g.collider.plane = physics::Plane{ physics::Vec3(0, 1, 0), 0.0f };
+        w->createBody(g);
+        return w;
+    };
+
+    for (const bool sparse : { false, true }) {
+        auto viaEcs = makeWorld(), manual = makeWorld();
+        ecs::World world;
+        world.setResource(physics_ecs::PhysicsWorldRef{ viaEcs.get() });
+        const physics_ecs::ArticulationEntities h =
+            physics_ecs::spawnArticulation(world, *viaEcs, physics::makeHumanoid(physics::Vec3(0, 1.05f, 0)));
+        physics::buildArticulation(*manual, physics::makeHumanoid(physics::Vec3(0, 1.05f, 0)));
+        if (sparse) world.destroy(h.jointEntities[3]);   // joint 3 keeps its default command
+
+        for (size_t k = 0; k < h.jointEntities.size(); ++k) {
+            if (sparse && k == 3) continue;
+            auto* c = world.get<physics_ecs::JointCommand>(h.jointEntities[k]);
+            c->target = 0.05f * float(k);
+            c->torque = 2.0f - 0.3f * float(k);
+            const physics::JointHandle j = world.get<const physics_ecs::Joint>(h.jointEntities[k])->joint;
+            manual->setJointTarget(j, c->target);
+            manual->setJointTorque(j, c->torque);
+        }
+        physics_ecs::actuatorFlushSystem(world);
+        for (int i = 0; i < 60; ++i) { viaEcs->step(1.0f / 120.0f); manual->step(1.0f / 120.0f); }
+        float maxErr = 0.0f;
+        for (size_t b = 0; b < viaEcs->poses().size(); ++b)
+            maxErr = std::max(maxErr, glm::length(viaEcs->poses()[b].position - manual->poses()[b].position));
+        TST_REQUIRE_MSG(maxErr == 0.0f, sparse ? "per-joint fallback diverged" : "bulk flush diverged");
+    }
+
+    // Pooled sync over a big table of falling spheres (plus one static body that never moves).
+    auto pw = makeWorld();
+    ecs::World serial, pooled;
+    const int n = 20000;
+    for (int i = 0; i < n; ++i) {
+        physics::BodyDef b;
+        b.type = i == 0 ? physics::BodyType::Static : physics::BodyType::Dynamic;
+        b.collider.type = physics::ColliderDesc::Type::Sphere;
+        b.collider.sphere = physics::Sphere{ 0.25f };
+        b.position = physics::Vec3(float(i % 100), 50.0f + float(i / 100), 0.0f);
+        const physics::BodyHandle body = pw->createBody(b);
+        for (ecs::World* w : { &serial, &pooled })
+            w->spawn(engine::Transform{}, physics_ecs::RigidBody{ body });
+    }
+    pw->step(1.0f / 120.0f);
+    core::ThreadPool pool(4);
+    physics_ecs::syncPoses(serial, *pw);
+    physics_ecs::syncPoses(pooled, *pw, &pool);
+    const uint32_t since = pooled.advanceTick();
+    pw->step(1.0f / 120.0f);
+    physics_ecs::syncPoses(pooled, *pw, &pool);
+    physics_ecs::syncPoses(serial, *pw);
+
+    std::vector<engine::Transform> a, b;
+    serial.query<const engine::Transform>().each([&](ecs::Entity, const engine::Transform& t) { a.push_back(t); });
+    pooled.query<const engine::Transform>().each([&](ecs::Entity, const engine::Transform& t) { b.push_back(t); });
+    TST_REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i) TST_REQUIRE(a[i].position == b[i].position && a[i].rotation == b[i].rotation);
+    int moved = 0;
+    pooled.query<const engine::Transform>().changed<engine::Transform>(since).each(
+        [&](ecs::Entity, const engine::Transform&) { ++moved; });
+    TST_REQUIRE(moved == n - 1);   // the static sphere wasn't rewritten
+
+    // A stale handle whose slot was reused by another body: its entity keeps its own pose.
+    ecs::World stale;
+    physics::BodyDef d;
+    d.type = physics::BodyType::Dynamic;
+    d.collider.type = physics::ColliderDesc::Type::Sphere;
+    d.position = physics::Vec3(0, 5, 0);
+    const physics::BodyHandle gone = pw->createBody(d);
+    const ecs::Entity e = stale.spawn(engine::Transform{ .position = glm::vec3(7, 7, 7) }, physics_ecs::RigidBody{ gone });
+    pw->destroyBody(gone);
+    d.position = physics::Vec3(0, 9, 0);
+    const physics::BodyHandle reuse = pw->createBody(d);
+    TST_REQUIRE(reuse.index == gone.index && reuse.generation != gone.generation);
+    pw->step(1.0f / 120.0f);
+    physics_ecs::syncPoses(stale, *pw, &pool);
+    TST_REQUIRE(stale.get<const engine::Transform>(e)->position == glm::vec3(7, 7, 7));
+
+    // Likewise a stale joint handle: its entity alone "covers" index 0, but its command must not
+    // reach the joint that reused the slot (bulk path refused, per-joint setter rejects it).
+    auto jw = makeWorld();
+    physics::BodyDef pin;
+    pin.type = physics::BodyType::Static;
+    pin.collider.type = physics::ColliderDesc::Type::Sphere;
+    pin.collider.sphere = physics::Sphere{ 0.05f };
+    pin.position = physics::Vec3(0, 3, 0);
+    physics::BodyDef bob = pin;
+    bob.type = physics::BodyType::Dynamic;
+    bob.position = physics::Vec3(0, 2, 0);
+    physics::JointDef jd;
+    jd.type = physics::JointType::Revolute;
+    jd.a = jw->createBody(pin);
+    jd.b = jw->createBody(bob);
+    jd.localAnchorB = physics::Vec3(0, 1, 0);
+    jd.actuator.mode = physics::ActuatorMode::Torque;
+    const physics::JointHandle old = jw->createJoint(jd);
+    ecs::World joints;
+    joints.setResource(physics_ecs::PhysicsWorldRef{ jw.get() });
+    joints.spawn(physics_ecs::Joint{ old }, physics_ecs::JointCommand{ .torque = 5.0f });
+    jw->destroyJoint(old);
+    const physics::JointHandle fresh = jw->createJoint(jd);
+    TST_REQUIRE(fresh.index == old.index && fresh.generation != old.generation);
+    physics_ecs::actuatorFlushSystem(joints);
+    for (int i = 0; i < 10; ++i) jw->step(1.0f / 120.0f);
+    TST_REQUIRE(std::fabs(jw->jointState(fresh).qd) < 1e-3f);   // no torque reached it
+}
@@ -172,7 +172,8 @@ TST_CASE(physics, integration, tall_stack) {
     }
 }
 
-// The two broadphases must feed the same narrowphase and converge to the same rest state.
+// The broadphases must feed the same narrowphase and converge to the same rest state; the tree
+// and the hierarchical grid emit exactly the grid's pair list, so they match bit for bit.
 TST_CASE(physics, integration, broadphase_equivalence) {
     auto build = [](BroadphaseKind bp) {
         auto w = makeWorld(Vec3(0, -9.81f, 0), 8, 1, bp);
@@ -191,14 +192,27 @@ TST_CASE(physics, integration, broadphase_equivalence) {
     };
     auto sap = build(BroadphaseKind::SweepAndPrune);
     auto grid = build(BroadphaseKind::UniformGrid);
-    for (int i = 0; i < 200; ++i) { sap->step(1.0f / 120.0f); grid->step(1.0f / 120.0f); }
+    auto tree = build(BroadphaseKind::DynamicTree);
+    auto hgrid = build(BroadphaseKind::HierarchicalGrid);
+    for (int i = 0; i < 200; ++i) {
+        sap->step(1.0f / 120.0f); grid->step(1.0f / 120.0f);
+        tree->step(1.0f / 120.0f); hgrid->step(1.0f / 120.0f);
+    }
     const auto ps = sap->poses();
     const auto pg = grid->poses();
-    TST_REQUIRE(ps.size() == pg.size());
-    Real maxErr = 0;
-    for (size_t k = 0; k < ps.size(); ++k) maxErr = std::max(maxErr, glm::length(ps[k].position - pg[k].position));
-    std::printf("broadphase_equivalence: max pos err SAP vs grid = %.3e\n", maxErr);
+    const auto pt = tree->poses();
+    const auto ph = hgrid->poses();
+    TST_REQUIRE(ps.size() == pg.size() && pt.size() == pg.size() && ph.size() == pg.size());
+    Real maxErr = 0, exactErr = 0;
+    for (size_t k = 0; k < ps.size(); ++k) {
+        maxErr = std::max(maxErr, glm::length(ps[k].position - pg[k].position));
+        exactErr = std::max(exactErr, glm::length(pt[k].position - pg[k].position));
+        exactErr = std::max(exactErr, glm::length(ph[k].position - pg[k].position));
+    }
+    std::printf("broadphase_equivalence: max pos err SAP vs grid = %.3e, tree/hgrid vs grid = %.3e\n",
+                maxErr, exactErr);
     TST_REQUIRE(maxErr < 1e-3f);
+    TST_REQUIRE(exactErr == 0);   // same pair list in the same order
 }
 
 // A kinematic body advances by its prescribed velocity, ignores gravity, and is not pushed back
@@ -6,8 +6,8 @@
 //    * pd_stand_holds_pose — with the pelvis pinned, PD servos on every joint hold the humanoid's
 //      neutral pose against gravity (hinges stay near their targets; the body doesn't collapse).
 //    * articulation_determinism — a serial world and a pooled/parallel world (threshold 1),
-//      identical humanoid + actuator commands, step bit-identically (joints are solved serially
-//      in creation order; the parallel contact/integration paths stay deterministic).
+//      identical humanoid + actuator commands, step bit-identically (joint and contact colors
+//      depend on the constraint set alone; the parallel paths stay deterministic).
 //
 
 #include <cmath>
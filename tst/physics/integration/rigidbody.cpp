@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <vector>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -81,6 +82,633 @@ TST_CASE(physics, integration, determinism) {
     TST_REQUIRE(maxErr < 1e-4f);
 }
 
+// Wide (SIMD-block) contact solve matches the one-at-a-time solve on a mixed box/sphere/capsule
+// pile, and stays bit-identical between serial and pooled runs.
+TST_CASE(physics, integration, wide_contacts) {
+    engine::core::ThreadPool pool;
+    auto run = [](bool wide, engine::core::ThreadPool* p) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.velocityIterations = 8;
+        wd.substeps = 2;
+        wd.wideContactSolver = wide;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 1 : 1000000;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef plane;
+        plane.type = BodyType::Static;
+        plane.collider.type = ColliderDesc::Type::Plane;
+        plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        plane.material.friction = 0.8f;
+        w->createBody(plane);
+        int k = 0;
+        for (int x = 0; x < 6; ++x)
+            for (int z = 0; z < 6; ++z)
+                for (int y = 0; y < 3; ++y, ++k) {
+                    BodyDef b;
+                    b.type = BodyType::Dynamic; b.mass = 1.0f + 0.25f * float(k % 3);
+                    b.material.friction = 0.4f + 0.1f * float(k % 5);
+                    b.position = Vec3(x * 0.9f + 0.05f * y, 0.6f + y * 1.05f, z * 0.9f);
+                    b.orientation = glm::angleAxis(0.3f * float(k % 7), glm::normalize(Vec3(1, 2, 3)));
+                    switch (k % 3) {
+                    case 0: b.collider.type = ColliderDesc::Type::Box;    b.collider.box = Box{ Vec3(0.4f) }; break;
+                    case 1: b.collider.type = ColliderDesc::Type::Sphere; b.collider.sphere = Sphere{ 0.45f }; break;
+                    default: b.collider.type = ColliderDesc::Type::Capsule; b.collider.capsule = Capsule{ 0.25f, 0.3f }; break;
+                    }
+                    w->createBody(b);
+                }
+        for (int i = 0; i < 180; ++i) w->step(1.0f / 60.0f);
+        const auto ps = w->poses();
+        return std::vector<engine::Transform>(ps.begin(), ps.end());
+    };
+    const auto scalar = run(false, nullptr);
+    const auto wide = run(true, nullptr);
+    const auto widePooled = run(true, &pool);
+    TST_REQUIRE(scalar.size() == wide.size() && wide.size() == widePooled.size());
+    Real maxErr = 0;
+    bool identical = true;
+    for (size_t k = 0; k < wide.size(); ++k) {
+        maxErr = std::max(maxErr, glm::length(scalar[k].position - wide[k].position));
+        identical = identical && wide[k].position == widePooled[k].position
+                              && wide[k].rotation == widePooled[k].rotation;
+        TST_REQUIRE(wide[k].position.y > -0.05f);   // nothing sank through the ground
+    }
+    std::printf("wide_contacts: max |wide - scalar| = %.3e, pooled identical = %d\n", maxErr, int(identical));
+    TST_REQUIRE(maxErr < 1e-3f);
+    TST_REQUIRE(identical);
+}
+
+// Shape-batched narrowphase: a pile of spheres, boxes and capsules on a plane (every batched
+// kind, plus box-box / capsule-box pairs on the generic path) reports the same contacts and
+// follows the same trajectory as the one-pair-at-a-time narrowphase, serial and pooled.
+TST_CASE(physics, integration, batched_narrowphase) {
+    engine::core::ThreadPool pool;
+    struct Run { std::vector<engine::Transform> poses; long contacts = 0; };
+    auto run = [](bool batched, engine::core::ThreadPool* p) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.batchedNarrowphase = batched;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 1 : 1000000;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef plane;
+        plane.type = BodyType::Static;
+        plane.collider.type = ColliderDesc::Type::Plane;
+        plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        w->createBody(plane);
+        int k = 0;
+        for (int x = 0; x < 7; ++x)
+            for (int z = 0; z < 7; ++z)
+                for (int y = 0; y < 3; ++y, ++k) {
+                    BodyDef b;
+                    b.type = BodyType::Dynamic; b.mass = 1.0f;
+                    b.position = Vec3(x * 0.95f + 0.07f * y, 0.5f + y * 1.0f, z * 0.95f);
+                    b.orientation = glm::angleAxis(0.4f * float(k % 5), glm::normalize(Vec3(1, 2, 3)));
+                    switch ((k + y) % 4) {
+                    case 0: b.collider.type = ColliderDesc::Type::Box;     b.collider.box = Box{ Vec3(0.35f) }; break;
+                    case 3: b.collider.type = ColliderDesc::Type::Capsule; b.collider.capsule = Capsule{ 0.2f, 0.3f }; break;
+                    default: b.collider.type = ColliderDesc::Type::Sphere; b.collider.sphere = Sphere{ 0.45f }; break;
+                    }
+                    w->createBody(b);
+                }
+        Run r;
+        for (int i = 0; i < 150; ++i) {
+            w->step(1.0f / 60.0f);
+            r.contacts += w->stepStats().contacts;
+        }
+        const auto ps = w->poses();
+        r.poses.assign(ps.begin(), ps.end());
+        return r;
+    };
+    const Run scalar = run(false, nullptr);
+    const Run batched = run(true, nullptr);
+    const Run pooled = run(true, &pool);
+    TST_REQUIRE(scalar.poses.size() == batched.poses.size() && batched.poses.size() == pooled.poses.size());
+    Real maxErr = 0;
+    bool identical = true;
+    for (size_t k = 0; k < batched.poses.size(); ++k) {
+        maxErr = std::max(maxErr, glm::length(scalar.poses[k].position - batched.poses[k].position));
+        identical = identical && batched.poses[k].position == pooled.poses[k].position
+                              && batched.poses[k].rotation == pooled.poses[k].rotation;
+        TST_REQUIRE(batched.poses[k].position.y > -0.05f);
+    }
+    std::printf("batched_narrowphase: contacts %ld vs %ld, max |batched - scalar| = %.3e, pooled identical = %d\n",
+                batched.contacts, scalar.contacts, maxErr, int(identical));
+    TST_REQUIRE(batched.contacts > 0);
+    TST_REQUIRE(maxErr < 1e-3f);
+    TST_REQUIRE(identical);
+}
+
+// Hub body: a heavy dynamic slab carrying a 2-layer sphere pile has more contacts than any color
+// scheme can spread, so they go to the serial tail color; the rest is colored in parallel rounds.
+// The pile rests on the slab, and serial and pooled runs stay bit-identical.
+TST_CASE(physics, integration, hub_coloring) {
+    engine::core::ThreadPool pool;
+    auto run = [](engine::core::ThreadPool* p) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 1 : 1000000;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef plane;
+        plane.type = BodyType::Static;
+        plane.collider.type = ColliderDesc::Type::Plane;
+        plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        w->createBody(plane);
+        BodyDef slab;
+        slab.type = BodyType::Dynamic; slab.mass = 200.0f;
+        slab.collider.type = ColliderDesc::Type::Box;
+        slab.collider.box = Box{ Vec3(5.0f, 0.25f, 5.0f) };
+        slab.position = Vec3(0, 0.25f, 0);
+        w->createBody(slab);
+        for (int x = 0; x < 9; ++x)
+            for (int z = 0; z < 9; ++z)
+                for (int y = 0; y < 2; ++y) {
+                    BodyDef s;
+                    s.type = BodyType::Dynamic; s.mass = 1.0f;
+                    s.collider.type = ColliderDesc::Type::Sphere;
+                    s.collider.sphere = Sphere{ 0.5f };
+                    s.position = Vec3(-4.0f + x * 1.0f + 0.5f * y, 1.0f + y * 0.9f, -4.0f + z * 1.0f + 0.5f * y);
+                    w->createBody(s);
+                }
+        for (int i = 0; i < 120; ++i) w->step(1.0f / 60.0f);
+        const auto ps = w->poses();
+        return std::vector<engine::Transform>(ps.begin(), ps.end());
+    };
+    const auto serial = run(nullptr);
+    const auto pooled = run(&pool);
+    TST_REQUIRE(serial.size() == pooled.size());
+    bool identical = true;
+    Real lowest = 1e9f;
+    for (size_t k = 0; k < serial.size(); ++k) {
+        identical = identical && serial[k].position == pooled[k].position
+                              && serial[k].rotation == pooled[k].rotation;
+        const Vec3 q = serial[k].position;
+        if (k >= 2 && std::abs(q.x) < 4.5f && std::abs(q.z) < 4.5f) lowest = std::min(lowest, q.y);   // on the slab
+    }
+    std::printf("hub_coloring: lowest sphere on the slab y = %.3f (rest 1.0), slab y = %.3f, identical = %d\n",
+                lowest, serial[1].position.y, int(identical));
+    TST_REQUIRE(std::abs(serial[1].position.y - 0.25f) < 0.05f);
+    TST_REQUIRE(lowest > 0.9f);
+    TST_REQUIRE(identical);
+}
+
+// Island solving: separate jointed chains plus a sphere pile, solved as independent islands on the
+// pool, match the serial step bit for bit.
+TST_CASE(physics, integration, islands) {
+    engine::core::ThreadPool pool;
+    auto run = [](engine::core::ThreadPool* p) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.contactWarmStart = true;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 16 : 1000000;   // pile island big enough to color-parallelize
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef plane;
+        plane.type = BodyType::Static;
+        plane.collider.type = ColliderDesc::Type::Plane;
+        plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        w->createBody(plane);
+        for (int c = 0; c < 24; ++c) {
+            BodyHandle prev{};
+            for (int k = 0; k < 6; ++k) {
+                BodyDef b;
+                b.type = BodyType::Dynamic; b.mass = 1.0f;
+                b.collider.type = ColliderDesc::Type::Capsule;
+                b.collider.capsule = Capsule{ 0.1f, 0.2f };
+                b.collisionCategory = 2; b.collisionMask = ~2u;
+                b.position = Vec3(float(c % 6) * 4.0f + 0.6f * k, 1.0f, float(c / 6) * 2.0f);
+                b.orientation = Quat(0.70710678f, 0, 0, 0.70710678f);
+                const BodyHandle h = w->createBody(b);
+                if (k > 0) {
+                    JointDef j;
+                    j.type = (k % 2) ? JointType::Ball : JointType::Revolute;
+                    j.a = prev; j.b = h;
+                    j.localAnchorA = Vec3(0, -0.3f, 0);
+                    j.localAnchorB = Vec3(0, 0.3f, 0);
+                    w->createJoint(j);
+                }
+                prev = h;
+            }
+        }
+        for (int x = 0; x < 4; ++x)
+            for (int z = 0; z < 4; ++z)
+                for (int y = 0; y < 3; ++y) {
+                    BodyDef s;
+                    s.type = BodyType::Dynamic; s.mass = 1.0f;
+                    s.collider.type = ColliderDesc::Type::Sphere;
+                    s.collider.sphere = Sphere{ 0.5f };
+                    s.position = Vec3(-10.0f + x * 0.9f, 0.6f + y * 0.95f, z * 0.9f);
+                    w->createBody(s);
+                }
+        for (int i = 0; i < 120; ++i) w->step(1.0f / 60.0f);
+        const auto ps = w->poses();
+        return std::vector<engine::Transform>(ps.begin(), ps.end());
+    };
+    const auto serial = run(nullptr);
+    const auto pooled = run(&pool);
+    TST_REQUIRE(serial.size() == pooled.size());
+    bool identical = true;
+    for (size_t k = 0; k < serial.size(); ++k) {
+        identical = identical && serial[k].position == pooled[k].position
+                              && serial[k].rotation == pooled[k].rotation;
+        TST_REQUIRE(serial[k].position.y > -0.05f);
+    }
+    std::printf("islands: serial vs pooled identical = %d\n", int(identical));
+    TST_REQUIRE(identical);
+}
+
+// Joint coloring: 16 hanging chains share one dynamic bar (one island), so only joint colors can
+// spread them over the pool. Serial and pooled runs match bit for bit and every joint holds.
+TST_CASE(physics, integration, joint_coloring) {
+    engine::core::ThreadPool pool;
+    struct Link { BodyHandle a, b; };
+    auto run = [](engine::core::ThreadPool* p, std::vector<Link>& links) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.velocityIterations = 12;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 1 : 1000000;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef bar;
+        bar.type = BodyType::Dynamic; bar.mass = 50.0f;
+        bar.collider.type = ColliderDesc::Type::Box;
+        bar.collider.box = Box{ Vec3(8.5f, 0.2f, 0.2f) };
+        bar.position = Vec3(0, 5.0f, 0);
+        bar.collisionMask = 0;
+        const BodyHandle hb = w->createBody(bar);
+        BodyDef anchor;                          // bar hangs from two static points
+        anchor.type = BodyType::Static;
+        anchor.collisionMask = 0;
+        links.clear();
+        for (const float x : { -8.0f, 8.0f }) {
+            anchor.position = Vec3(x, 5.0f, 0);
+            const BodyHandle ha = w->createBody(anchor);
+            JointDef j;
+            j.type = JointType::Ball;
+            j.a = ha; j.b = hb;
+            j.localAnchorB = Vec3(x, 0, 0);
+            w->createJoint(j);
+        }
+        for (int c = 0; c < 16; ++c) {
+            BodyHandle prev = hb;
+            for (int k = 0; k < 5; ++k) {
+                BodyDef b;
+                b.type = BodyType::Dynamic; b.mass = 1.0f;
+                b.collider.type = ColliderDesc::Type::Capsule;
+                b.collider.capsule = Capsule{ 0.08f, 0.2f };
+                b.collisionCategory = 2; b.collisionMask = ~2u;
+                const Vec3 down(0.70710678f, -0.70710678f, 0);   // links start 45° off vertical
+                b.position = Vec3(-7.5f + c * 1.0f, 4.8f, 0) + down * (0.3f + 0.6f * k);
+                b.orientation = glm::angleAxis(0.785398f, Vec3(0, 0, 1));
+                const BodyHandle h = w->createBody(b);
+                JointDef j;
+                j.type = (k % 2) ? JointType::Ball : JointType::Revolute;
+                j.a = prev; j.b = h;
+                j.localAnchorA = prev == hb ? Vec3(-7.5f + c * 1.0f, -0.2f, 0) : Vec3(0, -0.3f, 0);
+                j.localAnchorB = Vec3(0, 0.3f, 0);
+                w->createJoint(j);
+                links.push_back({ prev, h });
+                prev = h;
+            }
+        }
+        for (int i = 0; i < 120; ++i) w->step(1.0f / 60.0f);
+        const auto ps = w->poses();
+        return std::vector<engine::Transform>(ps.begin(), ps.end());
+    };
+    std::vector<Link> links, pooledLinks;
+    const auto serial = run(nullptr, links);
+    const auto pooled = run(&pool, pooledLinks);
+    TST_REQUIRE(serial.size() == pooled.size());
+    bool identical = true;
+    for (size_t k = 0; k < serial.size(); ++k)
+        identical = identical && serial[k].position == pooled[k].position
+                              && serial[k].rotation == pooled[k].rotation;
+    Real maxGap = 0;                             // chain-link joints (capsule ends)
+    for (const Link& l : links) {
+        if (l.a.index == 0) continue;            // bar → first link
+        const engine::Transform& ta = serial[l.a.index];
+        const engine::Transform& tb = serial[l.b.index];
+        const Vec3 pa = ta.position + ta.rotation * Vec3(0, -0.3f, 0);
+        const Vec3 pb = tb.position + tb.rotation * Vec3(0, 0.3f, 0);
+        maxGap = std::max(maxGap, glm::length(pa - pb));
+    }
+    std::printf("joint_coloring: max link gap = %.4f, serial vs pooled identical = %d\n", maxGap, int(identical));
+    TST_REQUIRE(maxGap < 0.02f);
+    TST_REQUIRE(identical);
+}
+
+// Direct joint solve: 8 chains of 10 light links, each ending in a 20 kg weight (mass ratio 40),
+// hung from a static anchor and released 45° off vertical. With 2 velocity iterations Gauss-Seidel
+// cannot carry the weight up the chain and the links stretch apart; the tree solve holds them. Serial
+// and pooled runs must match bit for bit.
+TST_CASE(physics, integration, direct_joint_solver) {
+    engine::core::ThreadPool pool;
+    auto run = [](engine::core::ThreadPool* p, bool direct) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.velocityIterations = 2;
+        wd.directJointSolver = direct;
+        wd.threadPool = p;
+        wd.parallelThreshold = p ? 1 : 1000000;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef anchor;
+        anchor.type = BodyType::Static;
+        anchor.collisionMask = 0;
+        std::vector<std::pair<BodyHandle, BodyHandle>> links;
+        const Vec3 down(0.70710678f, -0.70710678f, 0);
+        for (int c = 0; c < 8; ++c) {
+            anchor.position = Vec3(c * 3.0f, 10.0f, 0);
+            BodyHandle prev = w->createBody(anchor);
+            for (int k = 0; k < 10; ++k) {
+                BodyDef b;
+                b.type = BodyType::Dynamic;
+                b.mass = k == 9 ? 20.0f : 0.5f;
+                b.collider.type = ColliderDesc::Type::Capsule;
+                b.collider.capsule = Capsule{ 0.05f, 0.1f };
+                b.collisionMask = 0;
+                b.position = anchor.position + down * (0.15f + 0.3f * k);
+                b.orientation = glm::angleAxis(0.785398f, Vec3(0, 0, 1));
+                const BodyHandle h = w->createBody(b);
+                JointDef j;
+                j.type = (k % 3 == 1) ? JointType::Revolute : JointType::Ball;
+                j.a = prev; j.b = h;
+                j.localAnchorA = k == 0 ? Vec3(0) : Vec3(0, -0.15f, 0);
+                j.localAnchorB = Vec3(0, 0.15f, 0);
+                w->createJoint(j);
+                if (k > 0) links.push_back({ prev, h });
+                prev = h;
+            }
+        }
+        Real maxGap = 0;
+        for (int i = 0; i < 120; ++i) {
+            w->step(1.0f / 60.0f);
+            for (const auto& [a, b] : links) {
+                const engine::Transform ta = w->pose(a), tb = w->pose(b);
+                const Vec3 pa = ta.position + ta.rotation * Vec3(0, -0.15f, 0);
+                const Vec3 pb = tb.position + tb.rotation * Vec3(0, 0.15f, 0);
+                maxGap = std::max(maxGap, glm::length(pa - pb));
+            }
+        }
+        const auto ps = w->poses();
+        return std::make_pair(maxGap, std::vector<engine::Transform>(ps.begin(), ps.end()));
+    };
+    const auto iterative = run(nullptr, false);
+    const auto serial = run(nullptr, true);
+    const auto pooled = run(&pool, true);
+    TST_REQUIRE(serial.second.size() == pooled.second.size());
+    bool identical = true;
+    for (size_t k = 0; k < serial.second.size(); ++k)
+        identical = identical && serial.second[k].position == pooled.second[k].position
+                              && serial.second[k].rotation == pooled.second[k].rotation;
+    std::printf("direct_joint_solver: max link gap iterative = %.4f, direct = %.4f, serial vs pooled identical = %d\n",
+                iterative.first, serial.first, int(identical));
+    TST_REQUIRE(serial.first < 0.01f);
+    TST_REQUIRE(serial.first < 0.25f * iterative.first);
+    TST_REQUIRE(identical);
+}
+
+// Step statistics: a mixed pile (spheres, boxes, hulls, capsules) on a plane. Every contact the
+// step generated is reported as an event, convex pairs go through GJK (EPA only on overlap), and
+// the stage times fit inside the step's total.
+TST_CASE(physics, integration, step_stats) {
+    WorldDef wd;
+    wd.gravity = Vec3(0, -9.81f, 0);
+    wd.substeps = 2;
+    auto w = createPhysicsWorld(Backend::Realtime, wd);
+    TST_REQUIRE(w->stepStats().contacts == 0 && w->stepStats().totalMs == 0.0);
+    BodyDef plane;
+    plane.type = BodyType::Static;
+    plane.collider.type = ColliderDesc::Type::Plane;
+    plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+    w->createBody(plane);
+    for (int k = 0; k < 24; ++k) {
+        BodyDef b;
+        b.type = BodyType::Dynamic; b.mass = 1.0f;
+        b.position = Vec3(float(k % 3) * 0.9f, 0.5f + float(k / 3) * 1.1f, float(k % 2) * 0.3f);
+        switch (k % 4) {
+        case 0: b.collider.type = ColliderDesc::Type::Sphere; b.collider.sphere = Sphere{ 0.45f }; break;
+        case 1: b.collider.type = ColliderDesc::Type::Box; b.collider.box = Box{ Vec3(0.4f) }; break;
+        case 2:
+            b.collider.type = ColliderDesc::Type::ConvexHull;
+            for (int sx = -1; sx <= 1; sx += 2)
+                for (int sy = -1; sy <= 1; sy += 2)
+                    for (int sz = -1; sz <= 1; sz += 2)
+                        b.collider.convexHull.vertices.push_back(Vec3(sx * 0.4f, sy * 0.3f, sz * 0.4f));
+            break;
+        default: b.collider.type = ColliderDesc::Type::Capsule; b.collider.capsule = Capsule{ 0.2f, 0.3f }; break;
+        }
+        w->createBody(b);
+    }
+    StepStats sum;
+    for (int i = 0; i < 90; ++i) {
+        w->step(1.0f / 60.0f);
+        const StepStats& st = w->stepStats();
+        TST_REQUIRE(st.contacts == static_cast<long>(w->contacts().size()));
+        TST_REQUIRE(st.epaCalls <= st.gjkCalls);
+        TST_REQUIRE(st.broadphaseMs + st.narrowphaseMs + st.graphMs + st.solveMs + st.integrateMs <= st.totalMs);
+        accumulate(sum, st);
+    }
+    std::printf("step_stats: pairs=%ld contacts=%ld gjk=%ld epa=%ld colors=%d islands=%d sweeps=%ld total=%.2f ms\n",
+                sum.candidatePairs, sum.contacts, sum.gjkCalls, sum.epaCalls, sum.contactColors, sum.islands,
+                sum.velocitySweeps, sum.totalMs);
+    TST_REQUIRE(sum.candidatePairs > 0 && sum.contacts > 0);
+    TST_REQUIRE(sum.gjkCalls > 0 && sum.epaCalls > 0);
+    TST_REQUIRE(sum.contactColors > 0 && sum.islands > 0);
+    TST_REQUIRE(sum.velocityIterations == wd.velocityIterations);
+    TST_REQUIRE(sum.totalMs > 0.0);
+}
+
+// GJK temporal coherence: in a resting layer of hulls with small gaps, neighbour pairs stay
+// separated along their cached axis, so most GJK queries are skipped; a hull dropped onto the layer
+// still finds its overlap (the cached axis stops separating) and comes to rest on top.
+TST_CASE(physics, integration, gjk_axis_cache) {
+    WorldDef wd;
+    wd.gravity = Vec3(0, -9.81f, 0);
+    wd.substeps = 2;
+    auto w = createPhysicsWorld(Backend::Realtime, wd);
+    BodyDef plane;
+    plane.type = BodyType::Static;
+    plane.collider.type = ColliderDesc::Type::Plane;
+    plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+    plane.material.friction = 0.8f;
+    w->createBody(plane);
+    BodyDef hull;
+    hull.type = BodyType::Dynamic; hull.mass = 1.0f;
+    hull.material.friction = 0.8f;
+    hull.collider.type = ColliderDesc::Type::ConvexHull;
+    for (int sx = -1; sx <= 1; sx += 2)
+        for (int sy = -1; sy <= 1; sy += 2)
+            for (int sz = -1; sz <= 1; sz += 2)
+                hull.collider.convexHull.vertices.push_back(Vec3(sx * 0.4f, sy * 0.3f, sz * 0.4f));
+    for (int x = 0; x < 6; ++x)
+        for (int z = 0; z < 6; ++z) {
+            BodyDef b = hull;
+            b.position = Vec3(float(x) * 0.815f, 0.3f, float(z) * 0.815f);
+            w->createBody(b);
+        }
+    for (int i = 0; i < 60; ++i) w->step(1.0f / 60.0f);
+    StepStats rest;
+    for (int i = 0; i < 60; ++i) { w->step(1.0f / 60.0f); accumulate(rest, w->stepStats()); }
+
+    BodyDef drop = hull;
+    drop.position = Vec3(2.0f, 2.0f, 2.0f);
+    const BodyHandle dh = w->createBody(drop);
+    StepStats fall;
+    for (int i = 0; i < 120; ++i) { w->step(1.0f / 60.0f); accumulate(fall, w->stepStats()); }
+    std::printf("gjk_axis_cache: resting gjk=%ld axis hits=%ld; with drop gjk=%ld hits=%ld epa=%ld, top y=%.3f\n",
+                rest.gjkCalls, rest.gjkAxisHits, fall.gjkCalls, fall.gjkAxisHits, fall.epaCalls,
+                w->pose(dh).position.y);
+    TST_REQUIRE(rest.gjkAxisHits > 0);
+    TST_REQUIRE(rest.gjkAxisHits > 10 * rest.gjkCalls);
+    TST_REQUIRE(fall.epaCalls > 0);
+    TST_REQUIRE(w->pose(dh).position.y > 0.8f);   // resting on the layer top (y = 0.6)
+}
+
+// Sleeping: a settled layer of boxes freezes exactly (still reporting its contacts), wakes when a sphere
+// lands on it, and a resting hinge pendulum wakes when its joint torque is commanded.
+TST_CASE(physics, integration, sleeping) {
+    WorldDef wd;
+    wd.gravity = Vec3(0, -9.81f, 0);
+    wd.substeps = 2;
+    wd.allowSleep = true;
+    auto w = createPhysicsWorld(Backend::Realtime, wd);
+    BodyDef plane;
+    plane.type = BodyType::Static;
+    plane.collider.type = ColliderDesc::Type::Plane;
+    plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+    plane.material.friction = 0.8f;
+    w->createBody(plane);
+    for (int x = 0; x < 3; ++x)
+        for (int z = 0; z < 3; ++z) {
+            BodyDef b;
+            b.type = BodyType::Dynamic; b.mass = 1.0f;
+            b.collider.type = ColliderDesc::Type::Box;
+            b.collider.box = Box{ Vec3(0.5f) };
+            b.material.friction = 0.8f;
+            b.position = Vec3(float(x), 0.5f, float(z));
+            w->createBody(b);
+        }
+    // Pendulum hanging at rest under a static anchor, far from the pile.
+    BodyDef anchor;
+    anchor.type = BodyType::Static;
+    anchor.collider.type = ColliderDesc::Type::Sphere;
+    anchor.collider.sphere = Sphere{ 0.05f };
+    anchor.position = Vec3(20, 3, 0);
+    const BodyHandle ah = w->createBody(anchor);
+    BodyDef bob = anchor;
+    bob.type = BodyType::Dynamic; bob.mass = 1.0f;
+    bob.position = Vec3(20, 2, 0);
+    const BodyHandle bh = w->createBody(bob);
+    JointDef jd;
+    jd.type = JointType::Revolute;
+    jd.a = ah; jd.b = bh;
+    jd.localAnchorB = Vec3(0, 1, 0);
+    jd.actuator.mode = ActuatorMode::Torque;
+    const JointHandle jh = w->createJoint(jd);
+
+    auto allAtRest = [&] {
+        for (size_t i = 0; i < w->linearVelocities().size(); ++i)
+            if (w->linearVelocities()[i] != Vec3(0) || w->angularVelocities()[i] != Vec3(0)) return false;
+        return true;
+    };
+    for (int i = 0; i < 300; ++i) w->step(1.0f / 60.0f);
+    TST_REQUIRE(allAtRest());
+    const auto p = w->poses();
+    const std::vector<engine::Transform> frozen(p.begin(), p.end());
+    for (int i = 0; i < 60; ++i) w->step(1.0f / 60.0f);
+    for (size_t i = 0; i < frozen.size(); ++i)
+        TST_REQUIRE(w->poses()[i].position == frozen[i].position && w->poses()[i].rotation == frozen[i].rotation);
+    TST_REQUIRE(w->contacts().size() >= 9 * 4);   // the box-plane manifolds at least
+
+    BodyDef ball;
+    ball.type = BodyType::Dynamic; ball.mass = 2.0f;
+    ball.collider.type = ColliderDesc::Type::Sphere;
+    ball.collider.sphere = Sphere{ 0.4f };
+    ball.position = Vec3(1.0f, 3.0f, 1.0f);
+    const BodyHandle sh = w->createBody(ball);
+    bool pileWoke = false;
+    for (int i = 0; i < 120; ++i) {
+        w->step(1.0f / 60.0f);
+        for (uint32_t k = 1; k <= 9; ++k) pileWoke = pileWoke || w->linearVelocities()[k] != Vec3(0);
+    }
+    std::printf("sleeping: pile woke = %d, ball y = %.3f\n", int(pileWoke), w->pose(sh).position.y);
+    TST_REQUIRE(pileWoke);
+    TST_REQUIRE(w->pose(sh).position.y > 1.2f);   // resting on the layer top (y = 1), not inside it
+    TST_REQUIRE(w->angularVelocities()[bh.index] == Vec3(0));   // pendulum still asleep
+
+    w->setJointTorque(jh, 5.0f);
+    for (int i = 0; i < 10; ++i) w->step(1.0f / 60.0f);
+    TST_REQUIRE(std::fabs(w->angularVelocities()[bh.index].z) > 0.1f);
+}
+
+// Contact events off: contacts() stays empty while the simulation is unchanged — including a
+// settled, sleeping stack that a poke on its bottom layer wakes through the cached sleeper contacts.
+TST_CASE(physics, integration, contact_events_off) {
+    struct Run { std::vector<engine::Transform> poses; size_t reported = 0; long contacts = 0; bool asleep = false, topWoke = false; };
+    auto run = [](bool events) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -9.81f, 0);
+        wd.substeps = 2;
+        wd.allowSleep = true;
+        wd.contactEvents = events;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef plane;
+        plane.type = BodyType::Static;
+        plane.collider.type = ColliderDesc::Type::Plane;
+        plane.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        plane.material.friction = 0.8f;
+        w->createBody(plane);
+        for (int x = 0; x < 3; ++x)
+            for (int y = 0; y < 2; ++y) {
+                BodyDef b;
+                b.type = BodyType::Dynamic; b.mass = 1.0f;
+                b.collider.type = ColliderDesc::Type::Box;
+                b.collider.box = Box{ Vec3(0.5f) };
+                b.material.friction = 0.8f;
+                b.position = Vec3(float(x) * 1.5f, 0.5f + float(y), 0.0f);
+                w->createBody(b);
+            }
+        Run r;
+        for (int i = 0; i < 300; ++i) {
+            w->step(1.0f / 60.0f);
+            r.reported += w->contacts().size();
+            r.contacts += w->stepStats().contacts;
+        }
+        r.asleep = w->linearVelocities()[2] == Vec3(0);
+        const BodyHandle bottom{ 1, 0 };
+        const engine::Transform p = w->pose(bottom);
+        w->setBodyState(bottom, p.position, p.rotation, Vec3(0, 1, 0), Vec3(0));
+        for (int i = 0; i < 60; ++i) {
+            w->step(1.0f / 60.0f);
+            r.reported += w->contacts().size();
+            r.contacts += w->stepStats().contacts;
+            r.topWoke = r.topWoke || w->linearVelocities()[2] != Vec3(0);
+        }
+        r.poses.assign(w->poses().begin(), w->poses().end());
+        return r;
+    };
+    const Run on = run(true);
+    const Run off = run(false);
+    TST_REQUIRE(on.poses.size() == off.poses.size());
+    bool identical = true;
+    for (size_t k = 0; k < on.poses.size(); ++k)
+        identical = identical && on.poses[k].position == off.poses[k].position
+                              && on.poses[k].rotation == off.poses[k].rotation;
+    std::printf("contact_events_off: reported %zu vs %zu, contacts %ld vs %ld, identical = %d\n",
+                on.reported, off.reported, on.contacts, off.contacts, int(identical));
+    TST_REQUIRE(on.reported > 0);
+    TST_REQUIRE(off.reported == 0);
+    TST_REQUIRE(on.contacts == off.contacts);
+    TST_REQUIRE(identical);
+    TST_REQUIRE(off.asleep && off.topWoke);   // the top box slept, then woke with its base
+}
+
 // Box, sphere-on-box, and hull all come to rest flat.
 TST_CASE(physics, integration, resting) {
     auto w = groundWorld(12, 2);
@@ -113,6 +741,50 @@ TST_CASE(physics, integration, resting) {
     TST_REQUIRE(glm::length(w->angularVelocities()[hh.index]) < 0.4f);
 }
 
+// A hull whose points sit off the body origin turns about that origin: its inertia picks up the
+// parallel-axis term m(|c|² - c_z²) about z. The same torque spins a centred unit cube at
+// τh/(m/6) and one shifted 2 along x at τh/(m/6 + 4m), each pinned by a hinge at its origin.
+TST_CASE(physics, integration, hull_offset_inertia) {
+    WorldDef wd;
+    wd.gravity = Vec3(0);
+    auto w = createPhysicsWorld(Backend::Realtime, wd);
+    auto pinned = [&](const Vec3& at, const Vec3& offset) {
+        BodyDef pin;
+        pin.type = BodyType::Static;
+        pin.collider.type = ColliderDesc::Type::Sphere;
+        pin.collider.sphere = Sphere{ 0.05f };
+        pin.position = at;
+        const BodyHandle ph = w->createBody(pin);
+        BodyDef hull;
+        hull.type = BodyType::Dynamic; hull.mass = 1.0f;
+        hull.collider.type = ColliderDesc::Type::ConvexHull;
+        for (int sx = -1; sx <= 1; sx += 2)
+            for (int sy = -1; sy <= 1; sy += 2)
+                for (int sz = -1; sz <= 1; sz += 2)
+                    hull.collider.convexHull.vertices.push_back(offset + Vec3(sx, sy, sz) * 0.5f);
+        hull.position = at + Vec3(0, 0, 2);   // clear of the pin; the hinge spans the gap
+        const BodyHandle hh = w->createBody(hull);
+        JointDef jd;
+        jd.type = JointType::Revolute;
+        jd.a = ph; jd.b = hh;
+        jd.localAnchorA = Vec3(0, 0, 2);
+        jd.actuator.mode = ActuatorMode::Torque;
+        jd.actuator.torque = 1.0f;
+        w->createJoint(jd);
+        return hh;
+    };
+    const BodyHandle centred = pinned(Vec3(0), Vec3(0));
+    const BodyHandle shifted = pinned(Vec3(10, 0, 0), Vec3(2, 0, 0));
+    const Real h = 1.0f / 60.0f;
+    w->step(h);
+    const Real wc = w->angularVelocities()[centred.index].z;
+    const Real ws = w->angularVelocities()[shifted.index].z;
+    std::printf("hull_offset_inertia: w centred=%.4f (%.4f) shifted=%.4f (%.4f)\n",
+                wc, h * 6.0f, ws, h / (1.0f / 6.0f + 4.0f));
+    TST_REQUIRE(std::fabs(wc - h * 6.0f) < 1e-3f * h * 6.0f);
+    TST_REQUIRE(std::fabs(ws - h / (1.0f / 6.0f + 4.0f)) < 1e-3f * h / (1.0f / 6.0f + 4.0f));
+}
+
 // Boxes and hulls stack without toppling (multi-point face-clip manifolds).
 TST_CASE(physics, integration, stacking) {
     for (bool useHull : { false, true }) {
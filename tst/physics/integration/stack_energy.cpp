@@ -238,7 +238,10 @@ TST_CASE(physics, integration, cube_on_rounded_rock_launch) {
 // tower. Measures compression (sink from ideal), post-settle jitter, and any ejection/topple.
 // ---------------------------------------------------------------------------------------------
 namespace {
-void stackTest(int N) {
+struct StackResult { Real sink, maxTilt, maxSpeed; };
+
+// warm: -1 = the WorldDef default (or PHYS_WARM), else forces contactWarmStart.
+StackResult stackTest(int N, int warm = -1) {
     WorldDef wd;
     wd.gravity = Vec3(0, -18.0f, 0);
     wd.substeps = 4;
@@ -252,6 +255,7 @@ void stackTest(int N) {
     if (const char* s = std::getenv("PHYS_TGS"))      wd.contactSolver =
         std::atoi(s) ? ContactSolver::TGSSoft : ContactSolver::SequentialImpulse;
     applySolverEnv(wd);
+    if (warm >= 0) wd.contactWarmStart = warm != 0;
     auto w = createPhysicsWorld(Backend::Realtime, wd);
 
     BodyDef ground;
@@ -302,9 +306,81 @@ void stackTest(int N) {
     // SequentialImpulse under-converges deep stacks; see the contact-stability investigation). Here we
     // only assert the solver stays STABLE (no energy blow-up); the sink/tilt numbers are the tracked
     // metric. Set PHYS_TGS=1 (+ PHYS_SUBSTEPS=8) to exercise the TGS path (10-tall is rock-solid there).
-    TST_REQUIRE_MSG(maxSpeed < 5.0f, "stack exploded (solver energy blow-up)");
+    // A forced cold start (stack_warm_start's baseline) may still be toppling when measured.
+    if (warm != 0) TST_REQUIRE_MSG(maxSpeed < 5.0f, "stack exploded (solver energy blow-up)");
+    return { sink, maxTilt, maxSpeed };
 }
 } // namespace
 
-TST_CASE(physics, integration, stack_of_ten_boxes)    { stackTest(10); }
+// Ten-tall needs the warm start at 8 velocity iterations (cold, it topples; see below).
+TST_CASE(physics, integration, stack_of_ten_boxes)    { stackTest(10, 1); }
 TST_CASE(physics, integration, stack_of_thirty_boxes) { stackTest(30); }
+
+// Warm-starting from the feature-keyed impulse cache is what lets 8 velocity iterations hold a
+// 10-tall tower: cold, the same budget under-converges and the tower collapses.
+TST_CASE(physics, integration, stack_warm_start) {
+    const StackResult cold = stackTest(10, 0);
+    const StackResult warm = stackTest(10, 1);
+    std::printf("stack_warm_start: sink cold=%.3f warm=%.3f  tilt cold=%.1f warm=%.1f deg\n",
+                cold.sink, warm.sink, cold.maxTilt * 57.2958f, warm.maxTilt * 57.2958f);
+    TST_REQUIRE_MSG(warm.maxSpeed < 5.0f, "stack exploded (solver energy blow-up)");
+    TST_REQUIRE(warm.sink < 0.2f);
+    TST_REQUIRE(warm.maxTilt * 57.2958f < 10.0f);
+    TST_REQUIRE(warm.sink < cold.sink);
+}
+
+// Adaptive iteration counts (solver.velocityTolerance): a settled, warm-started 10-tall tower
+// converges in far fewer sweeps than the fixed budget, while the early-out still holds it as well.
+// The fixed run reports exactly its configured counts.
+TST_CASE(physics, integration, adaptive_iterations) {
+    struct Run { long sweeps; int maxIters; Real residual, sink; };
+    auto run = [](Real tol) {
+        WorldDef wd;
+        wd.gravity = Vec3(0, -18.0f, 0);
+        wd.substeps = 4;
+        wd.velocityIterations = 8;
+        wd.contactWarmStart = true;
+        wd.solver.velocityTolerance = tol;
+        wd.solver.positionTolerance = tol;
+        auto w = createPhysicsWorld(Backend::Realtime, wd);
+        BodyDef ground;
+        ground.type = BodyType::Static;
+        ground.collider.type = ColliderDesc::Type::Plane;
+        ground.collider.plane = Plane{ Vec3(0, 1, 0), 0.0f };
+        ground.material.friction = 0.9f;
+        w->createBody(ground);
+        BodyHandle top;
+        for (int i = 0; i < 10; ++i) {
+            BodyDef b;
+            b.type = BodyType::Dynamic; b.mass = 1.0f;
+            b.collider.type = ColliderDesc::Type::Box;
+            b.collider.box = Box{ Vec3(0.5f) };
+            b.material.friction = 0.9f;
+            b.position = Vec3(0, 0.5f + i * 1.02f, 0);
+            top = w->createBody(b);
+        }
+        for (int s = 0; s < 300; ++s) w->step(1.0f / 60.0f);
+        Run r{ 0, 0, 0, 0 };
+        for (int s = 0; s < 120; ++s) {
+            w->step(1.0f / 60.0f);
+            const StepStats& st = w->stepStats();
+            r.sweeps += st.velocitySweeps;
+            r.maxIters = std::max(r.maxIters, st.velocityIterations);
+            r.residual = std::max(r.residual, st.velocityResidual);
+            TST_REQUIRE(st.positionIterations >= 1 && st.positionSweeps >= st.positionIterations);
+        }
+        r.sink = Real(9.5) - w->pose(top).position.y;
+        return r;
+    };
+    const Run fixed = run(0);
+    const Run adaptive = run(Real(1e-2));   // ~5% of the bottom contacts' impulse per substep
+    std::printf("adaptive_iterations: sweeps fixed=%ld adaptive=%ld  max iters %d/%d  residual %.2e/%.2e  sink %.3f/%.3f\n",
+                fixed.sweeps, adaptive.sweeps, fixed.maxIters, adaptive.maxIters,
+                fixed.residual, adaptive.residual, fixed.sink, adaptive.sink);
+    TST_REQUIRE(fixed.maxIters == 8);
+    TST_REQUIRE(fixed.sweeps == 120 * 4 * 8);   // one island, 4 substeps, 8 sweeps each
+    TST_REQUIRE(adaptive.sweeps < fixed.sweeps / 2);
+    TST_REQUIRE(adaptive.maxIters < 32);        // converged below the cap every substep...
+    TST_REQUIRE(adaptive.residual <= Real(1e-2));   // ...so every final sweep met the tolerance
+    TST_REQUIRE(adaptive.sink < fixed.sink + 0.02f);
+}
@@ -48,6 +48,17 @@ TST_CASE(physics, unit, collision) {
         assert(!gjkIntersect(A, B, s));
         Contact c;
         assert(!collide::convexVsConvex(A, B, c));
+        // The reported separating axis proves separation on its own, and still does after a small
+        // move (temporal coherence); it stops once the boxes overlap, where GJK reports no axis.
+        Vec3 axis(0);
+        assert(!gjkIntersect(A, B, s, &axis));
+        assert(gjkSeparated(A, B, axis));
+        auto moved = SupportShape::box(Vec3(1.1f, 0.05f, 0), glm::angleAxis(0.05f, Vec3(0, 0, 1)), half);
+        assert(gjkSeparated(A, moved, axis));
+        auto touching = SupportShape::box(Vec3(0.9f, 0, 0), I, half);
+        assert(!gjkSeparated(A, touching, axis));
+        assert(gjkIntersect(A, touching, s, &axis) && axis == Vec3(0));
+        assert(!gjkSeparated(A, B, axis));   // a zero axis never claims separation
     }
 
     // Overlap along y by 0.3.
@@ -75,12 +75,15 @@ TST_CASE(physics, unit, config_presets) {
 TST_CASE(physics, unit, config_serialize_and_hash) {
     const SimConfig base;
     const std::string s = serialize(base);
-    TST_REQUIRE(contains(s, "configVersion=1"));
+    TST_REQUIRE(contains(s, "configVersion=4"));
     TST_REQUIRE(contains(s, "substeps=8"));
     TST_REQUIRE(contains(s, "backend=Realtime"));
     TST_REQUIRE(contains(s, "actionMode=Torque"));
     TST_REQUIRE(contains(s, "solver.pgsIterations=12"));
     TST_REQUIRE(contains(s, "solver.reducedMaxCorrection=4"));
+    TST_REQUIRE(contains(s, "solver.sleepTime=0.5"));
+    TST_REQUIRE(contains(s, "solver.treeFatMargin=0.1"));
+    TST_REQUIRE(contains(s, "solver.maxVelocityIterations=32"));
 
     // hash is deterministic + identity-sensitive
     TST_REQUIRE(configHash(base) == configHash(SimConfig{}));      // same values → same hash
@@ -88,6 +91,12 @@ TST_CASE(physics, unit, config_serialize_and_hash) {
     const SimConfig tuned = resolve(base, ov);
     TST_REQUIRE(configHash(tuned) != configHash(base));            // one knob differs → different hash
     TST_REQUIRE(contains(serialize(tuned), "substeps=64"));
+    SimConfig sleepy = base;
+    sleepy.solver.sleepTime = Real(1);
+    TST_REQUIRE(configHash(sleepy) != configHash(base));           // every SolverConfig knob counts
+    SimConfig adaptive = base;
+    adaptive.solver.velocityTolerance = Real(1e-2);
+    TST_REQUIRE(configHash(adaptive) != configHash(base));
 
     // dump() carries the hash line for per-run logging
     const std::string d = dump(configs::reducedHumanoid());
@@ -0,0 +1,169 @@
+//
+//  cooked_hull.cpp
+//  engine::tst / physics / unit
+//
+//  Cooked convex hulls: a noisy point cloud cooks to the minimal polytope (interior, mid-edge and
+//  mid-face points dropped, coplanar triangles merged), its mass properties are the exact solid
+//  ones, and every topology-walking query agrees with the brute-force vertex scan it replaces.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include "engine/physics/collision/convex_manifold.h"
+#include "engine/physics/collision/primitives.h"
+#include "engine/physics/collision/support.h"
+#include "engine/physics/shapes/cooked_hull.h"
+#include "harness/harness.h"
+
+using namespace engine::physics;
+
+namespace {
+// Box [-a, a]×[-b, b]×[-c, c] corners, padded with points that are not hull vertices.
+std::vector<Vec3> noisyBox(const Vec3& he) {
+    std::vector<Vec3> pts;
+    pts.push_back(Vec3(0));                                   // interior
+    pts.push_back(Vec3(0.1f, -0.2f, 0.05f) * he);             // interior
+    for (int sx = -1; sx <= 1; sx += 2)
+        for (int sy = -1; sy <= 1; sy += 2)
+            for (int sz = -1; sz <= 1; sz += 2)
+                pts.push_back(Vec3(sx, sy, sz) * he);
+    pts.push_back(Vec3(0, he.y, he.z));                        // mid-edge
+    pts.push_back(Vec3(he.x, 0.3f * he.y, -0.5f * he.z));      // on a face
+    pts.push_back(Vec3(0, -he.y, 0));                          // face centre
+    return pts;
+}
+
+bool near(Real a, Real b, Real e) { return std::fabs(a - b) <= e; }
+} // namespace
+
+// A box cloud cooks to 8 vertices, 6 quads and 24 half-edges, with consistent twins and loops,
+// and the solid box's volume and inertia ((b²+c²)/3 per unit mass about x, and so on).
+TST_CASE(physics, unit, cooked_hull_box) {
+    const Vec3 he(0.5f, 1.0f, 1.5f);
+    CookedHull h;
+    TST_REQUIRE(cookHull(noisyBox(he), h));
+    TST_REQUIRE(h.vertices.size() == 8);
+    TST_REQUIRE(h.faces.size() == 6);
+    TST_REQUIRE(h.edges.size() == 24);
+    for (size_t e = 0; e < h.edges.size(); ++e) {
+        const CookedHull::HalfEdge& he0 = h.edges[e];
+        TST_REQUIRE(h.edges[he0.twin].twin == e);
+        TST_REQUIRE(h.edges[he0.twin].face != he0.face);
+        TST_REQUIRE(h.edges[h.edges[he0.twin].next].origin == he0.origin);   // one-ring step
+    }
+    for (const CookedHull::Face& f : h.faces) {
+        TST_REQUIRE(f.count == 4);
+        uint16_t e = f.edge;
+        for (int k = 0; k < f.count; ++k) {
+            TST_REQUIRE(near(glm::dot(f.normal, h.vertices[h.edges[e].origin]), f.offset, 1e-5f));
+            e = h.edges[e].next;
+        }
+        TST_REQUIRE(e == f.edge);
+    }
+    TST_REQUIRE(near(h.volume, 8 * he.x * he.y * he.z, 1e-4f));
+    TST_REQUIRE(glm::length(h.centroid) < 1e-5f);
+    const Vec3 sq = he * he;
+    TST_REQUIRE(near(h.inertia[0][0], (sq.y + sq.z) / 3, 1e-4f));
+    TST_REQUIRE(near(h.inertia[1][1], (sq.x + sq.z) / 3, 1e-4f));
+    TST_REQUIRE(near(h.inertia[2][2], (sq.x + sq.y) / 3, 1e-4f));
+    TST_REQUIRE(std::fabs(h.inertia[0][1]) + std::fabs(h.inertia[0][2]) + std::fabs(h.inertia[1][2]) < 1e-5f);
+
+    CookedHull flat;
+    const std::vector<Vec3> square{ Vec3(0), Vec3(1, 0, 0), Vec3(0, 0, 1), Vec3(1, 0, 1) };
+    TST_REQUIRE(!cookHull(square, flat) && flat.empty());   // no volume: left uncooked
+}
+
+// Hill-climbing support lands on a vertex as far along the direction as the linear scan's, from
+// any start vertex, on a rounded hull with many vertices.
+TST_CASE(physics, unit, cooked_hull_support) {
+    std::vector<Vec3> pts;
+    for (int i = 0; i < 12; ++i)
+        for (int j = 1; j < 8; ++j) {
+            const Real th = Real(2 * 3.14159265) * i / 12, ph = Real(3.14159265) * j / 8;
+            pts.push_back(Vec3(std::sin(ph) * std::cos(th), 0.7f * std::cos(ph), 1.3f * std::sin(ph) * std::sin(th)));
+        }
+    pts.push_back(Vec3(0, 0.7f, 0));
+    pts.push_back(Vec3(0, -0.7f, 0));
+    CookedHull h;
+    TST_REQUIRE(cookHull(pts, h));
+    TST_REQUIRE(h.vertices.size() == pts.size());
+
+    const Quat q = glm::angleAxis(0.6f, glm::normalize(Vec3(1, 2, 3)));
+    const SupportShape cooked = SupportShape::hull(Vec3(1, 2, 3), q, h);
+    const SupportShape scan = SupportShape::hull(Vec3(1, 2, 3), q, h.vertices.data(), static_cast<int>(h.vertices.size()));
+    for (int k = 0; k < 200; ++k) {
+        const Real a = Real(0.37) * k, b = Real(0.11) * k;
+        const Vec3 d(std::cos(a) * std::cos(b), std::sin(b), std::sin(a) * std::cos(b));
+        TST_REQUIRE(near(glm::dot(cooked.support(d), d), glm::dot(scan.support(d), d), 1e-5f));
+        Real best = glm::dot(h.vertices[0], d);
+        for (const Vec3& v : h.vertices) best = std::max(best, glm::dot(v, d));
+        const int v = h.support(d, k % static_cast<int>(h.vertices.size()));
+        TST_REQUIRE(glm::dot(h.vertices[v], d) == best);
+    }
+}
+
+// Plane contacts from the flood fill equal pointsVsPlane over every world vertex (also for a patch
+// wider than the candidate buffer), and a cooked box resting on a cooked box clips to its 4 bottom
+// corners with distinct ids, like the vertex path.
+TST_CASE(physics, unit, cooked_hull_contacts) {
+    CookedHull h;
+    TST_REQUIRE(cookHull(noisyBox(Vec3(0.5f)), h));
+    const Plane ground{ Vec3(0, 1, 0), Real(0) };
+    const Quat tilts[] = { Quat(1, 0, 0, 0), glm::angleAxis(glm::radians(45.0f), Vec3(0, 0, 1)),
+                           glm::angleAxis(0.3f, glm::normalize(Vec3(1, 0, 2))) };
+    for (const Quat& q : tilts) {
+        const Vec3 c(0.2f, 0.45f, -0.1f);
+        std::vector<Vec3> wv;
+        for (const Vec3& v : h.vertices) wv.push_back(c + q * v);
+        Contact a[4], b[4];
+        const int na = collide::hullVsPlane(c, q, h, ground, Real(0.02f), a);
+        const int nb = collide::pointsVsPlane(wv.data(), static_cast<int>(wv.size()), ground, Real(0.02f), b);
+        TST_REQUIRE(na == nb && na > 0);
+        for (int i = 0; i < na; ++i) {
+            TST_REQUIRE(glm::length(a[i].point - b[i].point) < 1e-6f);
+            TST_REQUIRE(a[i].separation == b[i].separation && a[i].feature == b[i].feature);
+        }
+    }
+
+    // A 96-gon prism lying flat sinks a patch larger than the 64 candidates both paths keep.
+    CookedHull prism;
+    std::vector<Vec3> ring;
+    for (int i = 0; i < 96; ++i) {
+        const Real th = Real(2 * 3.14159265) * i / 96;
+        ring.push_back(Vec3(std::cos(th), -0.25f, std::sin(th)));
+        ring.push_back(Vec3(std::cos(th), 0.25f, std::sin(th)));
+    }
+    TST_REQUIRE(cookHull(ring, prism));
+    {
+        const Vec3 c(0, 0.24f, 0);
+        std::vector<Vec3> wv;
+        for (const Vec3& v : prism.vertices) wv.push_back(c + v);
+        Contact a[4], b[4];
+        const int na = collide::hullVsPlane(c, Quat(1, 0, 0, 0), prism, ground, Real(0.02f), a);
+        const int nb = collide::pointsVsPlane(wv.data(), static_cast<int>(wv.size()), ground, Real(0.02f), b);
+        TST_REQUIRE(na == nb && na == 4);
+        for (int i = 0; i < na; ++i) TST_REQUIRE(a[i].feature == b[i].feature);
+    }
+
+    // Top box sunk 0.01 into the base; EPA's answer is the base's top-face normal.
+    collide::PolytopeView base{ &unitBoxHull(), Vec3(1.0f, 0.5f, 1.0f), Vec3(0), Quat(1, 0, 0, 0) };
+    collide::PolytopeView top{ &h, Vec3(1), Vec3(0.1f, 0.99f, 0), glm::angleAxis(0.2f, Vec3(0, 1, 0)) };
+    Contact epa;
+    epa.normal = Vec3(0, 1, 0);
+    epa.point = Vec3(0.1f, 0.5f, 0);
+    epa.separation = -0.01f;
+    epa.touching = true;
+    Contact cs[4];
+    const int n = collide::polytopeManifold(base, top, epa, cs);
+    TST_REQUIRE(n == 4);
+    for (int i = 0; i < n; ++i) {
+        TST_REQUIRE(near(cs[i].separation, -0.01f, 1e-5f));
+        TST_REQUIRE(near(cs[i].point.y, 0.49f, 1e-5f));
+        TST_REQUIRE(glm::dot(cs[i].normal, Vec3(0, 1, 0)) > 0.999f);
+        for (int j = 0; j < i; ++j) TST_REQUIRE(cs[i].feature != cs[j].feature);
+    }
+}
@@ -9,11 +9,16 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <iterator>
+#include <random>
 #include <vector>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include "engine/core/threading/thread_pool.h"
+#include "engine/physics/broadphase/dynamic_tree.h"
+#include "engine/physics/broadphase/hierarchical_grid.h"
 #include "engine/physics/broadphase/sweep_and_prune.h"
 #include "engine/physics/broadphase/uniform_grid.h"
 #include "engine/physics/physics.h"
@@ -86,7 +91,7 @@ TST_CASE(physics, unit, sphere_contacts) {
     TST_REQUIRE(approxVec(cs.normal, Vec3(1, 0, 0)));
 }
 
-// Both broadphases produce exactly the brute-force overlap set.
+// All broadphases produce exactly the brute-force overlap set.
 TST_CASE(physics, unit, broadphase) {
     std::vector<Aabb> boxes;
     for (int gx = 0; gx < 6; ++gx)
@@ -94,14 +99,125 @@ TST_CASE(physics, unit, broadphase) {
             const Vec3 c(gx * 0.9f, gy * 0.9f, 0.0f);
             boxes.push_back(Aabb{ c - Vec3(0.5f), c + Vec3(0.5f) });
         }
-    std::vector<broadphase::Pair> sap, grid, brute;
+    std::vector<broadphase::Pair> sap, grid, hgrid, tree, brute;
     broadphase::sweepAndPrune(boxes, sap);
     broadphase::uniformGrid(boxes, grid);
+    broadphase::hierarchicalGrid(boxes, hgrid);
+    std::vector<uint32_t> ids(boxes.size());
+    for (uint32_t i = 0; i < ids.size(); ++i) ids[i] = i;
+    broadphase::DynamicTree dt;
+    dt.update(ids, boxes, tree);
     for (uint32_t i = 0; i < boxes.size(); ++i)
         for (uint32_t j = i + 1; j < boxes.size(); ++j)
             if (overlaps(boxes[i], boxes[j])) brute.emplace_back(i, j);
     std::sort(brute.begin(), brute.end());
     TST_REQUIRE(sap == brute);
     TST_REQUIRE(grid == brute);
+    TST_REQUIRE(hgrid == brute);
+    TST_REQUIRE(tree == brute);
     std::printf("broadphase: %zu pairs\n", brute.size());
 }
+
+// The pooled uniform grid (parallel entries, pairing and merge) returns exactly the serial
+// list, for any worker count, on a large crowded input with many pairs sharing several cells.
+TST_CASE(physics, unit, broadphase_pooled) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    std::vector<Aabb> boxes;
+    for (int k = 0; k < 20000; ++k) {
+        const Vec3 c(u(rng) * 40.0f, u(rng) * 10.0f, u(rng) * 40.0f);
+        const float half = k % 997 == 0 ? 2.0f : 0.3f + 0.2f * u(rng);
+        boxes.push_back(Aabb{ c - Vec3(half), c + Vec3(half) });
+    }
+    std::vector<broadphase::Pair> serial;
+    broadphase::uniformGrid(boxes, serial);
+    bool same = true;
+    for (unsigned workers : { 1u, 3u, 7u }) {
+        engine::core::ThreadPool pool(workers);
+        std::vector<broadphase::Pair> pooled;
+        for (int rep = 0; rep < 2; ++rep) {   // second call reuses the scratch
+            broadphase::uniformGrid(boxes, pooled, &pool);
+            same = same && pooled == serial;
+        }
+    }
+    std::printf("broadphase_pooled: %zu pairs, pooled == serial: %d\n", serial.size(), int(same));
+    TST_REQUIRE(!serial.empty());
+    TST_REQUIRE(same);
+}
+
+// Mixed sizes spanning 1000:1 (pebbles, limbs, boulders, one degenerate point box): the
+// hierarchical grid, like the others, reports exactly the brute-force overlap set.
+TST_CASE(physics, unit, broadphase_mixed_sizes) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    std::vector<Aabb> boxes;
+    for (int k = 0; k < 600; ++k) {
+        const float half = k % 100 == 0 ? 25.0f : (k % 10 == 0 ? 1.0f : 0.025f + 0.05f * u(rng));
+        const Vec3 c(u(rng) * 100.0f - 50.0f, u(rng) * 4.0f, u(rng) * 100.0f - 50.0f);
+        const Vec3 stretch(1.0f, k % 7 == 0 ? 3.0f : 1.0f, 1.0f);   // some elongated boxes
+        boxes.push_back(Aabb{ c - half * stretch, c + half * stretch });
+    }
+    boxes.push_back(Aabb{ Vec3(1.0f), Vec3(1.0f) });
+    std::vector<broadphase::Pair> sap, grid, hgrid, brute;
+    broadphase::sweepAndPrune(boxes, sap);
+    broadphase::uniformGrid(boxes, grid);
+    broadphase::hierarchicalGrid(boxes, hgrid);
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+        for (uint32_t j = i + 1; j < boxes.size(); ++j)
+            if (overlaps(boxes[i], boxes[j])) brute.emplace_back(i, j);
+    std::printf("broadphase_mixed_sizes: %zu pairs\n", brute.size());
+    TST_REQUIRE(sap == brute);
+    TST_REQUIRE(grid == brute);
+    TST_REQUIRE(hgrid == brute);
+}
+
+// The dynamic tree tracks moving, appearing and vanishing boxes of mixed sizes: every update's
+// pairs equal brute force, only boxes that left their fat box are reinserted, and the reported
+// added/removed sets account exactly for the change in the persistent pair set.
+TST_CASE(physics, unit, dynamic_tree) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    constexpr uint32_t kSlots = 300;
+    std::vector<Vec3> pos(kSlots), vel(kSlots);
+    std::vector<float> half(kSlots);
+    for (uint32_t i = 0; i < kSlots; ++i) {
+        pos[i] = Vec3(u(rng), u(rng), u(rng)) * 10.0f;
+        vel[i] = i % 3 == 0 ? Vec3(0) : Vec3(u(rng), u(rng), u(rng)) * 0.02f;   // a third stay put
+        half[i] = i % 50 == 0 ? 4.0f : 0.2f + 0.3f * std::fabs(u(rng));         // a few big boxes
+    }
+    broadphase::DynamicTree dt(0.1f);
+    std::vector<broadphase::Pair> prevFat;
+    bool allMatch = true, deltasMatch = true;
+    size_t moved = 0, updated = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        std::vector<uint32_t> ids;
+        std::vector<Aabb> boxes;
+        for (uint32_t i = 0; i < kSlots; ++i) {
+            if ((i + uint32_t(frame) / 20) % 7 == 0) continue;   // slots drop out and come back
+            pos[i] += vel[i];
+            ids.push_back(i);
+            boxes.push_back(Aabb{ pos[i] - Vec3(half[i]), pos[i] + Vec3(half[i]) });
+        }
+        std::vector<broadphase::Pair> tree, brute;
+        dt.update(ids, boxes, tree);
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+            for (uint32_t j = i + 1; j < boxes.size(); ++j)
+                if (overlaps(boxes[i], boxes[j])) brute.emplace_back(i, j);
+        allMatch = allMatch && tree == brute;
+        if (frame % 20 != 0) { moved += dt.lastMoved(); updated += ids.size(); }
+
+        // prev - removed + added == current fat set (reconstructed from the deltas).
+        std::vector<broadphase::Pair> fat, tmp;
+        std::set_difference(prevFat.begin(), prevFat.end(), dt.removed().begin(), dt.removed().end(),
+                            std::back_inserter(tmp));
+        std::merge(tmp.begin(), tmp.end(), dt.added().begin(), dt.added().end(), std::back_inserter(fat));
+        deltasMatch = deltasMatch && fat.size() == dt.pairCount() && fat.size() >= tree.size();
+        prevFat = fat;
+    }
+    std::printf("dynamic_tree: pairs match = %d, deltas consistent = %d, reinserted %.1f%%, "
+                "height = %d\n", int(allMatch), int(deltasMatch), 100.0 * double(moved) / double(updated), dt.height());
+    TST_REQUIRE(allMatch);
+    TST_REQUIRE(deltasMatch);
+    TST_REQUIRE(moved * 5 < updated);     // slow movers stay inside their fat boxes most frames
+    TST_REQUIRE(dt.height() < 24);        // balanced, not a list
+}
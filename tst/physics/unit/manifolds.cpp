@@ -5,7 +5,8 @@
 //  Contact-manifold generation against a half-space plane. The *count* and *depths* of contacts
 //  drive stable resting: a flat box must yield 4 corners, an edge-balanced box 2, a deeply
 //  buried box the 4 deepest (never more than 4); a lying capsule yields 2 endpoints, a standing
-//  one just its lower cap.
+//  one just its lower cap. Feature ids name the vertex/edge/face pair behind each point, so a
+//  point keeps its id (and its warm-start impulse) when the manifold shifts or loses a point.
 //
 
 #include <cmath>
@@ -13,6 +14,7 @@
 
 #include <glm/gtc/quaternion.hpp>
 
+#include "engine/physics/collision/box_box.h"
 #include "engine/physics/collision/capsule.h"
 #include "engine/physics/collision/primitives.h"
 #include "harness/harness.h"
@@ -78,3 +80,43 @@ TST_CASE(physics, unit, capsule_plane_standing) {
     TST_REQUIRE(n == 1);
     TST_REQUIRE(std::fabs(cs[0].separation) < 1e-4f);
 }
+
+// Box resting on a box, then nudged and slightly turned: the same 4 corners touch, every point
+// keeps a distinct non-zero id, and each id maps to the point it had before.
+TST_CASE(physics, unit, box_box_feature_ids) {
+    const Box base{ Vec3(1.0f, 0.5f, 1.0f) };
+    const Box top{ Vec3(0.3f) };
+    Contact before[4], after[4];
+    const int n0 = collide::boxVsBox(Vec3(0), Quat(1, 0, 0, 0), base,
+                                     Vec3(0, 0.79f, 0), Quat(1, 0, 0, 0), top, before);
+    const Quat turned = glm::angleAxis(glm::radians(2.0f), Vec3(0, 1, 0));
+    const int n1 = collide::boxVsBox(Vec3(0), Quat(1, 0, 0, 0), base,
+                                     Vec3(0.01f, 0.79f, 0.005f), turned, top, after);
+    TST_REQUIRE(n0 == 4 && n1 == 4);
+    for (int i = 0; i < n1; ++i) {
+        TST_REQUIRE(after[i].feature != 0);
+        int match = -1;
+        for (int j = 0; j < n0; ++j) {
+            if (j != i) TST_REQUIRE(after[i].feature != after[j].feature);
+            if (before[j].feature == after[i].feature) match = j;
+        }
+        TST_REQUIRE(match >= 0);
+        TST_REQUIRE(glm::length(after[i].point - before[match].point) < 0.03f);
+    }
+}
+
+// A lying capsule tilted so its -x endpoint lifts off: the surviving contact keeps the id of its
+// endpoint whatever its index in the manifold (a positional key could hand it the other's impulse).
+TST_CASE(physics, unit, capsule_plane_feature_ids) {
+    const Capsule cap{ 0.4f, 0.6f };
+    const Quat lying = glm::angleAxis(glm::radians(90.0f), Vec3(0, 0, 1));
+    Contact flat[2], tilted[2];
+    TST_REQUIRE(collide::capsuleVsPlane(Vec3(0, 0.4f, 0), lying, cap, kGround, Real(0), flat) == 2);
+    TST_REQUIRE(flat[0].feature != flat[1].feature);
+    const Quat tilt = glm::angleAxis(glm::radians(80.0f), Vec3(0, 0, 1));   // -x end rises
+    const Vec3 center(0, 0.4f + 0.6f * std::cos(glm::radians(80.0f)), 0);
+    TST_REQUIRE(collide::capsuleVsPlane(center, tilt, cap, kGround, Real(0), tilted) == 1);
+    const uint32_t lowId = flat[0].point.x > flat[1].point.x ? flat[0].feature : flat[1].feature;
+    TST_REQUIRE(tilted[0].point.x > 0);
+    TST_REQUIRE(tilted[0].feature == lowId);
+}
@@ -58,3 +58,36 @@ TST_CASE(physics_env, integration, vec_env_parallel_determinism) {
     for (float v : parallel.observations()) TST_REQUIRE(std::isfinite(v));
     TST_REQUIRE(maxErr == 0.0f);   // parallel batch == serial, bit-identical
 }
+
+// The batch's physics counters are the per-env stepStats() folded together, and the work counts
+// are as deterministic as the state (pooled == serial); times only have to be present.
+TST_CASE(physics_env, integration, vec_env_step_stats) {
+    for (const physics::Backend backend : { physics::Backend::Realtime, physics::Backend::Reduced }) {
+        physics_env::EnvConfig cfg;
+        cfg.articulation = physics::makeHumanoid();
+        cfg.sim.backend = backend;
+        constexpr size_t N = 6;
+        engine::core::ThreadPool pool;
+        physics_env::VecEnv parallel(N, cfg, &pool);
+        physics_env::VecEnv serial(N, cfg, nullptr);
+        parallel.reset(7);
+        serial.reset(7);
+        long contacts = 0;
+        for (int t = 0; t < 40; ++t) {
+            parallel.step();
+            serial.step();
+            const physics::StepStats& ps = parallel.stepStats();
+            const physics::StepStats& ss = serial.stepStats();
+            TST_REQUIRE(ps.contacts == ss.contacts && ps.velocitySweeps == ss.velocitySweeps);
+            TST_REQUIRE(ps.velocityResidual == ss.velocityResidual);
+            long envContacts = 0;
+            for (size_t i = 0; i < N; ++i) envContacts += parallel.env(i).stepStats().contacts;
+            TST_REQUIRE(ps.contacts == envContacts);
+            TST_REQUIRE(ps.totalMs > 0.0);
+            contacts += ps.contacts;
+        }
+        std::printf("vec_env_step_stats: %s contacts over 40 steps = %ld\n",
+                    backend == physics::Backend::Reduced ? "reduced" : "realtime", contacts);
+        TST_REQUIRE(contacts > 0);   // the humanoids land on the ground
+    }
+}